@@ -0,0 +1,389 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   queue_bench.cpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+// Throughput and latency benchmarks for "producer_consumer_queue" and "blocking_queue".
+// Each message carries its creation timestamp, consumer records the 
+// delivery latency of every message. Results are written as CSV,
+// one line per benchmark configuration.
+//
+// usage: queue_bench [--messages N] [--capacity N] [--pin] [--filter NAME] [--output FILE]
+
+#include "staticlib/containers/blocking_queue.hpp"
+#include "staticlib/containers/producer_consumer_queue.hpp"
+#include "staticlib/containers/detail/eventcount.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif // __linux__
+
+namespace sc = staticlib::containers;
+
+namespace { // anonymous
+
+int64_t now_nanos() {
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+struct msg8 {
+    int64_t stamp;
+};
+
+struct msg64 {
+    int64_t stamp;
+    char payload[56];
+};
+
+struct msg_string {
+    int64_t stamp;
+    std::string payload;
+};
+
+template<typename M>
+struct msg_traits;
+
+template<>
+struct msg_traits<msg8> {
+    static const char* name() {
+        return "8B";
+    }
+
+    static msg8 make() {
+        msg8 res;
+        res.stamp = now_nanos();
+        return res;
+    }
+};
+
+template<>
+struct msg_traits<msg64> {
+    static const char* name() {
+        return "64B";
+    }
+
+    static msg64 make() {
+        msg64 res;
+        res.stamp = now_nanos();
+        std::memset(res.payload, 42, sizeof(res.payload));
+        return res;
+    }
+};
+
+template<>
+struct msg_traits<msg_string> {
+    static const char* name() {
+        return "string";
+    }
+
+    static msg_string make() {
+        msg_string res;
+        res.stamp = now_nanos();
+        // longer than SSO buffer to include heap traffic
+        res.payload = std::string(64, '#');
+        return res;
+    }
+};
+
+struct config {
+    size_t messages = 1 << 20;
+    size_t capacity = 1 << 12;
+    bool pin = false;
+    std::string filter;
+    std::string output;
+};
+
+struct run_params {
+    size_t batch;
+    size_t producers;
+    size_t consumers;
+};
+
+struct result {
+    double seconds = 0;
+    std::vector<int64_t> latencies;
+};
+
+// moves elements when passed as rvalue to 'emplace_range'
+template<typename T>
+struct span {
+    T* first;
+    T* last;
+
+    T* begin() const {
+        return first;
+    }
+
+    T* end() const {
+        return last;
+    }
+};
+
+void pin_thread(const config& cfg, size_t idx) {
+#ifdef __linux__
+    unsigned int cores = std::thread::hardware_concurrency();
+    if (!cfg.pin || 0 == cores) {
+        return;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(idx % cores, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof (set), &set);
+#else
+    (void) cfg;
+    (void) idx;
+#endif // __linux__
+}
+
+void backoff(size_t& spins) {
+    spins += 1;
+    if (spins < 64) {
+        sc::detail::cpu_relax();
+    } else {
+        std::this_thread::yield();
+    }
+}
+
+void record_latencies(std::vector<int64_t>& latencies, int64_t stamp) {
+    latencies.push_back(now_nanos() - stamp);
+}
+
+template<typename M, typename Queue, typename Emplace>
+void produce(Queue& queue, size_t count, size_t batch, Emplace emplace_one) {
+    std::vector<M> buf;
+    buf.reserve(batch);
+    size_t sent = 0;
+    while (sent < count) {
+        size_t spins = 0;
+        if (1 == batch) {
+            M msg = msg_traits<M>::make();
+            while (!emplace_one(queue, msg)) {
+                backoff(spins);
+            }
+            sent += 1;
+        } else {
+            size_t len = std::min(batch, count - sent);
+            buf.clear();
+            for (size_t i = 0; i < len; i++) {
+                buf.push_back(msg_traits<M>::make());
+            }
+            size_t done = 0;
+            while (done < len) {
+                size_t emplaced = queue.emplace_range(span<M>{buf.data() + done, buf.data() + len});
+                if (0 == emplaced) {
+                    backoff(spins);
+                }
+                done += emplaced;
+            }
+            sent += len;
+        }
+    }
+}
+
+template<typename M>
+result run_pcq(const config& cfg, const run_params& rp) {
+    sc::producer_consumer_queue<M> queue(static_cast<uint32_t>(cfg.capacity));
+    result res;
+    res.latencies.reserve(cfg.messages);
+    auto start = std::chrono::steady_clock::now();
+    std::thread producer([&] {
+        pin_thread(cfg, 0);
+        produce<M>(queue, cfg.messages, rp.batch, [](sc::producer_consumer_queue<M>& qu, M& msg) {
+            return qu.emplace(std::move(msg));
+        });
+    });
+    std::thread consumer([&] {
+        pin_thread(cfg, 1);
+        std::vector<M> buf(rp.batch);
+        size_t received = 0;
+        size_t spins = 0;
+        while (received < cfg.messages) {
+            size_t count = 0;
+            if (1 == rp.batch) {
+                count = queue.poll(buf[0]) ? 1 : 0;
+            } else {
+                count = queue.poll_n(buf.begin(), rp.batch);
+            }
+            if (0 == count) {
+                backoff(spins);
+                continue;
+            }
+            spins = 0;
+            for (size_t i = 0; i < count; i++) {
+                record_latencies(res.latencies, buf[i].stamp);
+            }
+            received += count;
+        }
+    });
+    producer.join();
+    consumer.join();
+    res.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return res;
+}
+
+template<typename M>
+result run_blocking_queue(const config& cfg, const run_params& rp) {
+    sc::blocking_queue<M> queue(cfg.capacity);
+    std::atomic<size_t> received{0};
+    std::vector<std::vector<int64_t>> latencies(rp.consumers);
+    std::vector<std::thread> threads;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < rp.producers; i++) {
+        size_t count = cfg.messages / rp.producers + (0 == i ? cfg.messages % rp.producers : 0);
+        threads.emplace_back([&cfg, &rp, &queue, i, count] {
+            pin_thread(cfg, i);
+            produce<M>(queue, count, rp.batch, [](sc::blocking_queue<M>& qu, M& msg) {
+                return qu.put(std::move(msg));
+            });
+        });
+    }
+    for (size_t i = 0; i < rp.consumers; i++) {
+        threads.emplace_back([&cfg, &rp, &queue, &received, &latencies, i] {
+            pin_thread(cfg, rp.producers + i);
+            auto& lat = latencies[i];
+            lat.reserve(cfg.messages / rp.consumers);
+            std::vector<M> buf;
+            buf.reserve(rp.batch);
+            while (received.load(std::memory_order_relaxed) < cfg.messages) {
+                buf.clear();
+                M msg;
+                if (1 == rp.batch) {
+                    if (queue.take(msg, 10)) {
+                        buf.push_back(std::move(msg));
+                    }
+                } else {
+                    queue.take_n(buf, rp.batch, 10);
+                }
+                for (auto& el : buf) {
+                    record_latencies(lat, el.stamp);
+                }
+                received.fetch_add(buf.size(), std::memory_order_relaxed);
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    result res;
+    res.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    res.latencies.reserve(cfg.messages);
+    for (auto& lat : latencies) {
+        res.latencies.insert(res.latencies.end(), lat.begin(), lat.end());
+    }
+    return res;
+}
+
+int64_t percentile(const std::vector<int64_t>& sorted, double quantile) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    size_t idx = static_cast<size_t>(static_cast<double>(sorted.size()) * quantile);
+    return sorted[std::min(idx, sorted.size() - 1)];
+}
+
+void report(std::ostream& out, const config& cfg, const char* queue_name, const char* element,
+        const run_params& rp, result& res) {
+    std::sort(res.latencies.begin(), res.latencies.end());
+    out << queue_name << "," << element << "," << rp.batch << "," << rp.producers << "," 
+            << rp.consumers << "," << (cfg.pin ? 1 : 0) << "," << res.latencies.size() << ","
+            << res.seconds << "," << static_cast<uint64_t>(static_cast<double>(res.latencies.size()) / res.seconds) << ","
+            << percentile(res.latencies, 0.5) << "," << percentile(res.latencies, 0.99) << ","
+            << percentile(res.latencies, 0.999) << std::endl;
+}
+
+template<typename M>
+void bench_element(std::ostream& out, const config& cfg) {
+    const size_t batches[] = {1, 32, 256};
+    if (cfg.filter.empty() || "producer_consumer_queue" == cfg.filter) {
+        for (size_t batch : batches) {
+            run_params rp{batch, 1, 1};
+            std::cerr << "producer_consumer_queue " << msg_traits<M>::name() << " batch: " << batch << std::endl;
+            auto res = run_pcq<M>(cfg, rp);
+            report(out, cfg, "producer_consumer_queue", msg_traits<M>::name(), rp, res);
+        }
+    }
+    if (cfg.filter.empty() || "blocking_queue" == cfg.filter) {
+        const size_t threads[][2] = {{1, 1}, {4, 4}, {16, 1}};
+        for (size_t batch : batches) {
+            for (auto& th : threads) {
+                run_params rp{batch, th[0], th[1]};
+                std::cerr << "blocking_queue " << msg_traits<M>::name() << " batch: " << batch <<
+                        " producers: " << th[0] << " consumers: " << th[1] << std::endl;
+                auto res = run_blocking_queue<M>(cfg, rp);
+                report(out, cfg, "blocking_queue", msg_traits<M>::name(), rp, res);
+            }
+        }
+    }
+}
+
+config parse_args(int argc, char** argv) {
+    config cfg;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if ("--messages" == arg && has_value) {
+            cfg.messages = std::strtoul(argv[++i], nullptr, 10);
+        } else if ("--capacity" == arg && has_value) {
+            cfg.capacity = std::strtoul(argv[++i], nullptr, 10);
+        } else if ("--pin" == arg) {
+            cfg.pin = true;
+        } else if ("--filter" == arg && has_value) {
+            cfg.filter = argv[++i];
+        } else if ("--output" == arg && has_value) {
+            cfg.output = argv[++i];
+        } else {
+            std::cerr << "usage: queue_bench [--messages N] [--capacity N] [--pin]"
+                    " [--filter producer_consumer_queue|blocking_queue] [--output FILE]" << std::endl;
+            std::exit(1);
+        }
+    }
+    return cfg;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    config cfg = parse_args(argc, argv);
+    std::ofstream file;
+    if (!cfg.output.empty()) {
+        file.open(cfg.output.c_str());
+    }
+    std::ostream& out = cfg.output.empty() ? std::cout : file;
+    out << "queue,element,batch,producers,consumers,pinned,messages,seconds,ops_per_sec,p50_ns,p99_ns,p999_ns" << std::endl;
+    bench_element<msg8>(out, cfg);
+    bench_element<msg64>(out, cfg);
+    bench_element<msg_string>(out, cfg);
+    return 0;
+}
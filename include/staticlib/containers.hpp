@@ -24,8 +24,26 @@
 #ifndef STATICLIB_CONTAINERS_HPP
 #define	STATICLIB_CONTAINERS_HPP
 
+#include "staticlib/containers/blocking_mpmc_queue.hpp"
+#include "staticlib/containers/blocking_priority_queue.hpp"
+#include "staticlib/containers/blocking_producer_consumer_queue.hpp"
 #include "staticlib/containers/blocking_queue.hpp"
+#include "staticlib/containers/broadcast_queue.hpp"
+#include "staticlib/containers/conflating_queue.hpp"
+#include "staticlib/containers/delay_queue.hpp"
+#include "staticlib/containers/mpmc_queue.hpp"
+#include "staticlib/containers/mpsc_queue.hpp"
+#include "staticlib/containers/object_pool.hpp"
 #include "staticlib/containers/producer_consumer_queue.hpp"
+#include "staticlib/containers/queue_selector.hpp"
+#include "staticlib/containers/queue_stats.hpp"
+#include "staticlib/containers/ring_allocation.hpp"
+#include "staticlib/containers/ring_buffer.hpp"
+#include "staticlib/containers/segmented_producer_consumer_queue.hpp"
+#include "staticlib/containers/sharded_blocking_queue.hpp"
+#include "staticlib/containers/shared_producer_consumer_queue.hpp"
+#include "staticlib/containers/work_stealing_deque.hpp"
+#include "staticlib/containers/work_stealing_queue.hpp"
 
 #endif	/* STATICLIB_CONTAINERS_HPP */
 
@@ -0,0 +1,240 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   blocking_mpmc_queue.hpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#ifndef STATICLIB_CONTAINERS_BLOCKING_MPMC_QUEUE_HPP
+#define	STATICLIB_CONTAINERS_BLOCKING_MPMC_QUEUE_HPP
+
+#include <cstdint>
+#include <atomic>
+#include <utility>
+
+#include "staticlib/containers/mpmc_queue.hpp"
+#include "staticlib/containers/detail/eventcount.hpp"
+
+namespace staticlib {
+namespace containers {
+
+/**
+ * Bounded lock-free FIFO queue built on "mpmc_queue" with
+ * support for waiting, supports multiple producers and multiple consumers.
+ * Consumers will block on "take" from empty queue, producers will block
+ * on "put" into full queue. Waiting threads spin for a short time, then
+ * yield the CPU, and only then park themselves. Parked threads are woken 
+ * up one per element, wake up calls are skipped when nobody is parked.
+ */
+template<typename T>
+class blocking_mpmc_queue {
+    mpmc_queue<T> queue;
+    detail::eventcount not_empty;
+    detail::eventcount not_full;
+    std::atomic<bool> blocking;
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    blocking_mpmc_queue(const blocking_mpmc_queue&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return reference to self
+     */
+    blocking_mpmc_queue& operator=(const blocking_mpmc_queue&) = delete;
+
+public:
+    /**
+     * Type of elements
+     */
+    typedef T value_type;
+
+    /**
+     * Constructor, queue size is rounded up to the power of two
+     * 
+     * @param size queue size, must be >= 1
+     */
+    explicit blocking_mpmc_queue(size_t size) :
+    queue(size),
+    blocking(true) { }
+
+    /**
+     * Emplace a value at the end of the queue, this method returns immediately
+     * 
+     * @param recordArgs constructor arguments for queue element
+     * @return false if the queue was full, true otherwise
+     */
+    template<typename ...Args>
+    bool emplace(Args&&... record_args) {
+        if (queue.emplace(std::forward<Args>(record_args)...)) {
+            not_empty.notify_one();
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Emplace the values from specified range into this queue,
+     * this method returns immediately
+     * 
+     * @param range source range
+     * @return number of elements emplaced
+     */
+    template<typename Range>
+    size_t emplace_range(Range&& range) {
+        size_t count = queue.emplace_range(std::forward<Range>(range));
+        if (1 == count) {
+            not_empty.notify_one();
+        } else if (count > 1) {
+            not_empty.notify_all();
+        }
+        return count;
+    }
+
+    /**
+     * Put a value at the end of the queue. This method will wait on full
+     * queue infinitely (by default), or up to specified amount of milliseconds
+     * 
+     * @param record value to move (or copy) into the queue
+     * @param timeout_millis max amount of milliseconds to wait on full queue,
+     *        negative value (supplied by default) will cause infinite wait
+     * @return false if the queue was full after timeout or was unblocked, true otherwise
+     */
+    template<typename R>
+    bool put(R&& record, int32_t timeout_millis = -1) {
+        auto attempt = [this, &record] {
+            return this->emplace(std::forward<R>(record));
+        };
+        return detail::spin_then_park(not_full, blocking, timeout_millis, attempt);
+    }
+
+    /**
+     * Attempt to read the value at the front to the queue into a variable.
+     * This method returns immediately.
+     * 
+     * @param record move (or copy) the value at the front of the queue to given variable
+     * @return returns false if queue was empty, true otherwise
+     */
+    bool poll(T& record) {
+        if (queue.poll(record)) {
+            not_full.notify_one();
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Consume the contents of this queue into specified functor
+     * until the queue is found to be empty, this method returns immediately
+     * 
+     * @param func functor to consume contents
+     * @return number of elements consumed
+     */
+    template<typename Func>
+    size_t consume(Func func) {
+        size_t count = queue.consume(func);
+        if (count > 0) {
+            not_full.notify_all();
+        }
+        return count;
+    }
+
+    /**
+     * Attempt to read the value at the front of the queue into a variable.
+     * This method will wait on empty queue infinitely (by default), 
+     * or up to specified amount of milliseconds
+     * 
+     * @param record move (or copy) the value at the front of the queue to given variable
+     * @param timeout_millis max amount of milliseconds to wait on empty queue,
+     *        negative value (supplied by default) will cause infinite wait
+     * @return returns false if queue was empty after timeout or was unblocked, true otherwise
+     */
+    bool take(T& record, int32_t timeout_millis = -1) {
+        auto attempt = [this, &record] {
+            return this->poll(record);
+        };
+        return detail::spin_then_park(not_empty, blocking, timeout_millis, attempt);
+    }
+
+    /**
+     * Unblocks the queue allowing consumers to exit 'take' calls
+     * and producers to exit 'put' calls. Queue cannot be used
+     * for waiting on it after this call.
+     */
+    void unblock() {
+        blocking.store(false, std::memory_order_release);
+        not_empty.notify_all();
+        not_full.notify_all();
+    }
+
+    /**
+     * Checks whether this queue was unblocked
+     * 
+     * @return whether this queue was unblocked
+     */
+    bool is_blocking() const {
+        return blocking.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Check if the queue is empty, see "mpmc_queue::is_empty"
+     * 
+     * @return whether queue is empty
+     */
+    bool is_empty() const {
+        return queue.is_empty();
+    }
+
+    /**
+     * Check if the queue is full, see "mpmc_queue::is_full"
+     * 
+     * @return whether queue is full
+     */
+    bool is_full() const {
+        return queue.is_full();
+    }
+
+    /**
+     * Returns the number of entries in the queue, see "mpmc_queue::size"
+     * 
+     * @return number of entries in the queue
+     */
+    size_t size() const {
+        return queue.size();
+    }
+
+    /**
+     * Accessor for max queue size, see "mpmc_queue::max_size"
+     * 
+     * @return max queue size
+     */
+    size_t max_size() const {
+        return queue.max_size();
+    }
+};
+
+}
+} // namespace
+
+#endif	/* STATICLIB_CONTAINERS_BLOCKING_MPMC_QUEUE_HPP */
@@ -0,0 +1,285 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   blocking_priority_queue.hpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#ifndef STATICLIB_CONTAINERS_BLOCKING_PRIORITY_QUEUE_HPP
+#define	STATICLIB_CONTAINERS_BLOCKING_PRIORITY_QUEUE_HPP
+
+#include <cstdint>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <utility>
+
+#include "staticlib/containers/detail/dary_heap.hpp"
+
+namespace staticlib {
+namespace containers {
+
+/**
+ * Behaviour of the bounded "blocking_priority_queue" on full queue
+ */
+enum class overflow_policy {
+    /**
+     * New element is rejected
+     */
+    reject,
+    /**
+     * Element with the lowest priority (possibly the new one) is dropped
+     */
+    evict_lowest
+};
+
+/**
+ * Optionally bounded priority queue with synchronized access to all
+ * public methods. Supports multiple producers and multiple consumers.
+ * Consumers will block on "take" from empty queue. Elements are taken
+ * in priority order, ordering follows "std::priority_queue": with default
+ * "std::less" the greatest element is taken first. Elements are kept in
+ * 4-ary heap, eviction of the lowest priority element on full queue
+ * scans the leaves of the heap.
+ */
+template<typename T, typename Compare = std::less<T>>
+class blocking_priority_queue {
+    mutable std::mutex mutex;
+    std::condition_variable empty_cv;
+    detail::dary_heap<T, Compare> heap;
+    size_t max_size;
+    overflow_policy policy;
+    size_t waiting_consumers = 0;
+    bool blocking = true;
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other instance
+     */
+    blocking_priority_queue(const blocking_priority_queue&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other instance
+     * @return reference to self
+     */
+    blocking_priority_queue& operator=(const blocking_priority_queue&) = delete;
+
+    /**
+     * Adds new element to the heap, must be called under the lock
+     *
+     * @param record new element
+     * @return false if the element was rejected, true otherwise
+     */
+    bool push_internal(T&& record) {
+        if (0 == max_size || heap.size() < max_size) {
+            heap.emplace(std::move(record));
+        } else if (overflow_policy::evict_lowest == policy) {
+            size_t bottom = heap.bottom_index();
+            if (!heap.comparator()(heap.at(bottom), record)) {
+                // new element has the lowest priority itself
+                return false;
+            }
+            heap.replace_leaf(bottom, std::move(record));
+        } else {
+            return false;
+        }
+        if (waiting_consumers > 0) {
+            empty_cv.notify_one();
+        }
+        return true;
+    }
+
+    /**
+     * Waits on empty queue, must be called under the lock
+     *
+     * @param lock lock on the queue mutex
+     * @param timeout_millis max amount of milliseconds to wait on empty queue,
+     *        negative value will cause infinite wait
+     * @return false if queue is still empty, true otherwise
+     */
+    bool wait_not_empty(std::unique_lock<std::mutex>& lock, int32_t timeout_millis) {
+        if (heap.empty()) {
+            auto predicate = [this] {
+                return !this->blocking || !this->heap.empty();
+            };
+            waiting_consumers += 1;
+            if (timeout_millis >= 0) {
+                empty_cv.wait_for(lock, std::chrono::milliseconds{timeout_millis}, predicate);
+            } else {
+                empty_cv.wait(lock, predicate);
+            }
+            waiting_consumers -= 1;
+        }
+        return !heap.empty();
+    }
+
+public:
+    /**
+     * Type of elements
+     */
+    typedef T value_type;
+
+    /**
+     * Constructor, optional bound size and the behaviour
+     * on full queue can be specified, unbounded by default
+     *
+     * @param max_size queue size bound
+     * @param policy behaviour on full queue
+     * @param compare comparison functor
+     */
+    blocking_priority_queue(size_t max_size = 0, overflow_policy policy = overflow_policy::reject,
+            const Compare& compare = Compare()) :
+    heap(compare),
+    max_size(max_size),
+    policy(policy) {
+        if (max_size > 0) {
+            heap.reserve(max_size);
+        }
+    }
+
+    /**
+     * Emplace a value into the queue
+     *
+     * @param recordArgs constructor arguments for queue element
+     * @return false if the queue was full and the value was rejected
+     *         (or it had the lowest priority with "evict_lowest" policy),
+     *         true otherwise
+     */
+    template<typename ...Args>
+    bool emplace(Args&&... record_args) {
+        T record(std::forward<Args>(record_args)...);
+        std::lock_guard<std::mutex> guard{mutex};
+        return push_internal(std::move(record));
+    }
+
+    /**
+     * Attempt to read the value with the highest priority into a variable.
+     * This method returns immediately.
+     *
+     * @param record move (or copy) the value with the highest priority to given variable
+     * @return returns false if queue was empty, true otherwise
+     */
+    bool poll(T& record) {
+        std::lock_guard<std::mutex> guard{mutex};
+        if (!heap.empty()) {
+            record = heap.pop();
+            return true;
+        } else {
+            return false;
+        }
+    }
+
+    /**
+     * Consume all the contents of this queue into
+     * specified functor in priority order
+     *
+     * @param func functor to consume contents
+     * @return number of elements consumed
+     */
+    template<typename Func>
+    size_t consume(Func func) {
+        std::lock_guard<std::mutex> guard{mutex};
+        size_t count = 0;
+        while (!heap.empty()) {
+            func(heap.pop());
+            count += 1;
+        }
+        return count;
+    }
+
+    /**
+     * Attempt to read the value with the highest priority into a variable.
+     * This method will wait on empty queue infinitely (by default),
+     * or up to specified amount of milliseconds
+     *
+     * @param record move (or copy) the value with the highest priority to given variable
+     * @param timeout_millis max amount of milliseconds to wait on empty queue,
+     *        negative value (supplied by default) will cause infinite wait
+     * @return returns false if queue was empty after timeout, true otherwise
+     */
+    bool take(T& record, int32_t timeout_millis = -1) {
+        std::unique_lock<std::mutex> lock{mutex};
+        if (wait_not_empty(lock, timeout_millis)) {
+            record = heap.pop();
+            return true;
+        } else {
+            return false;
+        }
+    }
+
+    /**
+     * Unblocks the queue allowing consumers to exit 'take' calls.
+     * Queue cannot be used for waiting on it after this call.
+     */
+    void unblock() {
+        std::lock_guard<std::mutex> guard{mutex};
+        this->blocking = false;
+        empty_cv.notify_all();
+    }
+
+    /**
+     * Checks whether this queue was unblocked
+     *
+     * @return whether this queue was unblocked
+     */
+    bool is_blocking() {
+        std::lock_guard<std::mutex> guard{mutex};
+        return blocking;
+    }
+
+    /**
+     * Check if the queue is empty
+     *
+     * @return whether queue is empty
+     */
+    bool is_empty() const {
+        std::lock_guard<std::mutex> guard{mutex};
+        return heap.empty();
+    }
+
+    /**
+     * Check if the queue is full, always false for unbounded queue
+     *
+     * @return whether queue is full
+     */
+    bool is_full() const {
+        std::lock_guard<std::mutex> guard{mutex};
+        if (0 == max_size) return false;
+        return heap.size() >= max_size;
+    }
+
+    /**
+     * Returns the number of entries in the queue
+     *
+     * @return number of entries in the queue
+     */
+    size_t size() const {
+        std::lock_guard<std::mutex> guard{mutex};
+        return heap.size();
+    }
+};
+
+}
+} // namespace
+
+#endif	/* STATICLIB_CONTAINERS_BLOCKING_PRIORITY_QUEUE_HPP */
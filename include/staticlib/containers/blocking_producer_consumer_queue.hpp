@@ -0,0 +1,435 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   blocking_producer_consumer_queue.hpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#ifndef STATICLIB_CONTAINERS_BLOCKING_PRODUCER_CONSUMER_QUEUE_HPP
+#define	STATICLIB_CONTAINERS_BLOCKING_PRODUCER_CONSUMER_QUEUE_HPP
+
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <utility>
+
+#include "staticlib/containers/producer_consumer_queue.hpp"
+#include "staticlib/containers/detail/awaiter.hpp"
+#include "staticlib/containers/detail/eventcount.hpp"
+
+namespace staticlib {
+namespace containers {
+
+/**
+ * One producer and one consumer lock-free queue with support for waiting.
+ * Consumer will block on "take" from empty queue, producer will block
+ * on "put" into full queue. Waiting thread spins for a short time, then
+ * yields the CPU, and only then parks itself. Parked threads are woken 
+ * up by the other side, wake up calls are skipped when nobody is parked.
+ */
+template<typename T>
+class blocking_producer_consumer_queue {
+    producer_consumer_queue<T> queue;
+    detail::eventcount not_empty;
+    detail::eventcount not_full;
+    std::atomic<bool> blocking;
+#ifdef __cpp_impl_coroutine
+    detail::awaiter_slot<T> take_waiter;
+    detail::awaiter_slot<T> put_waiter;
+#endif // __cpp_impl_coroutine
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    blocking_producer_consumer_queue(const blocking_producer_consumer_queue&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return reference to self
+     */
+    blocking_producer_consumer_queue& operator=(const blocking_producer_consumer_queue&) = delete;
+
+    /**
+     * Wakes up parked consumer and resumes suspended 'async_take' coroutine,
+     * must be called after elements were added
+     */
+    void notify_not_empty() {
+        not_empty.notify_all();
+#ifdef __cpp_impl_coroutine
+        // fence in "notify_all" orders the check after the index store
+        take_waiter.resume();
+#endif // __cpp_impl_coroutine
+    }
+
+    /**
+     * Wakes up parked producer and resumes suspended 'async_put' coroutine,
+     * must be called after elements were removed
+     */
+    void notify_not_full() {
+        not_full.notify_all();
+#ifdef __cpp_impl_coroutine
+        // fence in "notify_all" orders the check after the index store
+        put_waiter.resume();
+#endif // __cpp_impl_coroutine
+    }
+
+public:
+    /**
+     * Type of elements
+     */
+    typedef T value_type;
+
+    /**
+     * Constructor
+     * 
+     * @param size queue size, must be >= 1
+     * @param allocation options for the allocation of the storage
+     */
+    explicit blocking_producer_consumer_queue(uint32_t size,
+            const ring_allocation& allocation = ring_allocation()) :
+    queue(size, allocation),
+    blocking(true) { }
+
+    /**
+     * Emplace a value at the end of the queue, this method returns immediately
+     * 
+     * @param recordArgs constructor arguments for queue element
+     * @return false if the queue was full, true otherwise
+     */
+    template<class ...Args>
+    bool emplace(Args&&... record_args) {
+        if (queue.emplace(std::forward<Args>(record_args)...)) {
+            notify_not_empty();
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Emplace the values from specified range into this queue,
+     * this method returns immediately
+     * 
+     * @param range source range
+     * @return number of elements emplaced
+     */
+    template<typename Range>
+    size_t emplace_range(Range&& range) {
+        size_t count = queue.emplace_range(std::forward<Range>(range));
+        if (count > 0) {
+            notify_not_empty();
+        }
+        return count;
+    }
+
+    /**
+     * Copy the specified number of values into this queue,
+     * see "producer_consumer_queue::emplace_n", this method returns immediately
+     * 
+     * @param records pointer to the values to copy
+     * @param count number of values
+     * @return number of values copied
+     */
+    size_t emplace_n(const T* records, size_t count) {
+        size_t res = queue.emplace_n(records, count);
+        if (res > 0) {
+            notify_not_empty();
+        }
+        return res;
+    }
+
+    /**
+     * Put a value at the end of the queue. This method will wait on full
+     * queue infinitely (by default), or up to specified amount of milliseconds
+     * 
+     * @param record value to move (or copy) into the queue
+     * @param timeout_millis max amount of milliseconds to wait on full queue,
+     *        negative value (supplied by default) will cause infinite wait
+     * @return false if the queue was full after timeout or was unblocked, true otherwise
+     */
+    template<typename R>
+    bool put(R&& record, int32_t timeout_millis = -1) {
+        auto attempt = [this, &record] {
+            return this->emplace(std::forward<R>(record));
+        };
+        return detail::spin_then_park(not_full, blocking, timeout_millis, attempt);
+    }
+
+    /**
+     * Attempt to read the value at the front to the queue into a variable.
+     * This method returns immediately.
+     * 
+     * @param record move (or copy) the value at the front of the queue to given variable
+     * @return returns false if queue was empty, true otherwise
+     */
+    bool poll(T& record) {
+        if (queue.poll(record)) {
+            notify_not_full();
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Move up to the specified number of values from the front of the queue
+     * into the output iterator, this method returns immediately
+     * 
+     * @param out output iterator to move (or copy) the values into
+     * @param max_count max number of values to read
+     * @return number of values read, zero if queue was empty
+     */
+    template<typename OutputIterator>
+    size_t poll_n(OutputIterator out, size_t max_count) {
+        size_t count = queue.poll_n(out, max_count);
+        if (count > 0) {
+            notify_not_full();
+        }
+        return count;
+    }
+
+    /**
+     * Consume all the values currently available in this queue into
+     * specified functor, this method returns immediately
+     * 
+     * @param func functor to consume contents
+     * @return number of elements consumed
+     */
+    template<typename Func>
+    size_t consume(Func func) {
+        size_t count = queue.consume(func);
+        if (count > 0) {
+            notify_not_full();
+        }
+        return count;
+    }
+
+    /**
+     * Attempt to read the value at the front of the queue into a variable.
+     * This method will wait on empty queue infinitely (by default), 
+     * or up to specified amount of milliseconds
+     * 
+     * @param record move (or copy) the value at the front of the queue to given variable
+     * @param timeout_millis max amount of milliseconds to wait on empty queue,
+     *        negative value (supplied by default) will cause infinite wait
+     * @return returns false if queue was empty after timeout or was unblocked, true otherwise
+     */
+    bool take(T& record, int32_t timeout_millis = -1) {
+        auto attempt = [this, &record] {
+            return this->poll(record);
+        };
+        return detail::spin_then_park(not_empty, blocking, timeout_millis, attempt);
+    }
+
+    /**
+     * Unblocks the queue allowing consumers to exit 'take' calls
+     * and producers to exit 'put' calls. Queue cannot be used
+     * for waiting on it after this call.
+     */
+    void unblock() {
+        blocking.store(false, std::memory_order_release);
+        notify_not_empty();
+        notify_not_full();
+    }
+
+#ifdef __cpp_impl_coroutine
+    /**
+     * Awaitable returned from "async_take"
+     */
+    class take_awaiter : private detail::awaiter_node<T> {
+        friend class blocking_producer_consumer_queue;
+        blocking_producer_consumer_queue& queue;
+
+        take_awaiter(blocking_producer_consumer_queue& queue, T& record) :
+        queue(queue) {
+            this->record = std::addressof(record);
+        }
+
+    public:
+        /**
+         * Attempts to read the value without suspending
+         * 
+         * @return true if the value was read, false otherwise
+         */
+        bool await_ready() {
+            this->success = queue.poll(*this->record);
+            return this->success;
+        }
+
+        /**
+         * Suspends the coroutine until the value is added
+         * 
+         * @param handle calling coroutine
+         * @return false if the coroutine was not suspended, true otherwise
+         */
+        bool await_suspend(std::coroutine_handle<> handle) {
+            this->handle = handle;
+            blocking_producer_consumer_queue& qu = queue;
+            return qu.take_waiter.suspend(this, [&qu] {
+                return !qu.is_empty() || !qu.is_blocking();
+            });
+        }
+
+        /**
+         * Reads the value after the coroutine was resumed
+         * 
+         * @return false if the queue was empty and was unblocked, true otherwise
+         */
+        bool await_resume() {
+            if (!this->success) {
+                this->success = queue.poll(*this->record);
+            }
+            return this->success;
+        }
+    };
+
+    /**
+     * Awaitable returned from "async_put"
+     */
+    class put_awaiter : private detail::awaiter_node<T> {
+        friend class blocking_producer_consumer_queue;
+        blocking_producer_consumer_queue& queue;
+        T value;
+
+        template<typename R>
+        put_awaiter(blocking_producer_consumer_queue& queue, R&& record) :
+        queue(queue),
+        value(std::forward<R>(record)) { }
+
+    public:
+        /**
+         * Attempts to add the value without suspending
+         * 
+         * @return true if the value was added, false otherwise
+         */
+        bool await_ready() {
+            this->success = queue.emplace(std::move(value));
+            return this->success;
+        }
+
+        /**
+         * Suspends the coroutine until the space is available
+         * 
+         * @param handle calling coroutine
+         * @return false if the coroutine was not suspended, true otherwise
+         */
+        bool await_suspend(std::coroutine_handle<> handle) {
+            this->handle = handle;
+            blocking_producer_consumer_queue& qu = queue;
+            return qu.put_waiter.suspend(this, [&qu] {
+                return !qu.is_full() || !qu.is_blocking();
+            });
+        }
+
+        /**
+         * Adds the value after the coroutine was resumed
+         * 
+         * @return false if the queue was full and was unblocked, true otherwise
+         */
+        bool await_resume() {
+            if (!this->success) {
+                this->success = queue.emplace(std::move(value));
+            }
+            return this->success;
+        }
+    };
+
+    /**
+     * Read the value at the front of the queue into a variable, suspends
+     * the calling coroutine on empty queue. Can be called only by consumer,
+     * suspended coroutine is resumed on the producer thread when the value
+     * is added (or on the thread that called "unblock").
+     * 
+     * @param record move (or copy) the value at the front of the queue to given variable
+     * @return awaitable, "co_await" returns false if the queue was unblocked, true otherwise
+     */
+    take_awaiter async_take(T& record) {
+        return take_awaiter(*this, record);
+    }
+
+    /**
+     * Put a value at the end of the queue, suspends the calling coroutine
+     * on full queue. Can be called only by producer, suspended coroutine
+     * is resumed on the consumer thread when the value is removed
+     * (or on the thread that called "unblock").
+     * 
+     * @param record value to move (or copy) into the queue
+     * @return awaitable, "co_await" returns false if the queue was full
+     *         and was unblocked, true otherwise
+     */
+    template<typename R>
+    put_awaiter async_put(R&& record) {
+        return put_awaiter(*this, std::forward<R>(record));
+    }
+#endif // __cpp_impl_coroutine
+
+    /**
+     * Checks whether this queue was unblocked
+     * 
+     * @return whether this queue was unblocked
+     */
+    bool is_blocking() const {
+        return blocking.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Check if the queue is empty
+     * 
+     * @return whether queue is empty
+     */
+    bool is_empty() const {
+        return queue.is_empty();
+    }
+
+    /**
+     * Check if the queue is full
+     * 
+     * @return whether queue is full
+     */
+    bool is_full() const {
+        return queue.is_full();
+    }
+
+    /**
+     * Returns the number of entries in the queue,
+     * see "producer_consumer_queue::size_guess"
+     * 
+     * @return number of entries in the queue
+     */
+    size_t size_guess() const {
+        return queue.size_guess();
+    }
+
+    /**
+     * Accessor for max queue size specified at creation
+     * 
+     * @return max queue size
+     */
+    size_t max_size() const {
+        return queue.max_size();
+    }
+};
+
+}
+} // namespace
+
+#endif	/* STATICLIB_CONTAINERS_BLOCKING_PRODUCER_CONSUMER_QUEUE_HPP */
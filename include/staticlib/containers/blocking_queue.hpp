@@ -29,8 +29,14 @@
 #include <chrono>
 #include <condition_variable>
 #include <deque>
+#include <memory>
 #include <mutex>
 #include <type_traits>
+#include <utility>
+
+#include "staticlib/containers/queue_selector.hpp"
+#include "staticlib/containers/queue_stats.hpp"
+#include "staticlib/containers/detail/awaiter.hpp"
 
 namespace staticlib {
 namespace containers {
@@ -39,14 +45,31 @@ namespace containers {
  * Optionally bounded FIFO queue implementation with synchronized access to all 
  * public methods. Supports multiple producers and multiple consumers.
  * Consumers will block on "take" from empty queue.
+ * Elements are kept in "std::deque" by default, other deque-like storage
+ * (e.g. "ring_buffer") can be specified, storage with "reserve" method
+ * is pre-allocated for "max_size" elements on bounded queue creation.
+ * Optional counters can be enabled with "queue_stats" policy.
  */
-template<typename T>
+template<typename T, typename Storage = std::deque<T>, typename Stats = no_queue_stats>
 class blocking_queue { 
     mutable std::mutex mutex;
     std::condition_variable empty_cv;
-    std::deque<T> delegate;
+    std::condition_variable full_cv;
+    Storage delegate;
+    // copy is kept to create a new storage without taking the lock
+    const typename Storage::allocator_type storage_alloc;
     size_t max_size;
+    Stats counters;
+    // mirror of the storage size for non-locking accessors
+    std::atomic<size_t> size_mirror;
+    size_t waiting_consumers = 0;
+    size_t waiting_producers = 0;
     bool blocking = true;
+    queue_selector* selector = nullptr;
+#ifdef __cpp_impl_coroutine
+    detail::awaiter_list<T> take_awaiters;
+    detail::awaiter_list<T> put_awaiters;
+#endif // __cpp_impl_coroutine
 
     /**
      * Deleted copy constructor
@@ -62,6 +85,282 @@ class blocking_queue {
      * @return reference to self
      */
     blocking_queue& operator=(const blocking_queue&) = delete;
+
+    /**
+     * Wakes up as many consumers waiting in 'take' as there are new
+     * elements, must be called under the lock after elements were added.
+     * Elements are handed over directly to the suspended 'async_take'
+     * coroutines, that are resumed after unlocking.
+     * 
+     * @param count number of added elements
+     * @param ready coroutines to resume after unlocking
+     */
+    void notify_not_empty(size_t count, detail::resume_list<T>& ready) {
+#ifdef __cpp_impl_coroutine
+        size_t handed = 0;
+        while (!take_awaiters.empty() && !delegate.empty()) {
+            detail::awaiter_node<T>* node = take_awaiters.pop_front();
+            *node->record = std::move(delegate.front());
+            delegate.pop_front();
+            node->success = true;
+            ready.push_back(node);
+            handed += 1;
+        }
+        if (handed > 0) {
+            counters.on_dequeue(handed);
+            publish_size();
+            count -= handed < count ? handed : count;
+        }
+#else // __cpp_impl_coroutine
+        (void) ready;
+#endif // __cpp_impl_coroutine
+        if (nullptr != selector && count > 0) {
+            selector->notify();
+        }
+        if (waiting_consumers > 0 && count > 0) {
+            if (count >= waiting_consumers) {
+                empty_cv.notify_all();
+            } else {
+                for (size_t i = 0; i < count; i++) {
+                    empty_cv.notify_one();
+                }
+            }
+        }
+    }
+
+    /**
+     * Wakes up producers waiting in 'put', must be called
+     * under the lock after elements were removed. Elements of the suspended
+     * 'async_put' coroutines are added to the queue, coroutines
+     * are resumed after unlocking.
+     * 
+     * @param count number of removed elements
+     * @param ready coroutines to resume after unlocking
+     */
+    void notify_not_full(size_t count, detail::resume_list<T>& ready) {
+#ifdef __cpp_impl_coroutine
+        size_t handed = 0;
+        while (!put_awaiters.empty() && (0 == max_size || delegate.size() < max_size)) {
+            detail::awaiter_node<T>* node = put_awaiters.pop_front();
+            delegate.emplace_back(std::move(*node->record));
+            counters.on_enqueue(1, delegate.size());
+            node->success = true;
+            ready.push_back(node);
+            handed += 1;
+        }
+        if (handed > 0) {
+            publish_size();
+            count -= handed < count ? handed : count;
+            if (nullptr != selector) {
+                selector->notify();
+            }
+            if (waiting_consumers > 0) {
+                empty_cv.notify_all();
+            }
+        }
+#else // __cpp_impl_coroutine
+        (void) ready;
+#endif // __cpp_impl_coroutine
+        if (waiting_producers > 0 && count > 0) {
+            if (1 == count) {
+                full_cv.notify_one();
+            } else {
+                full_cv.notify_all();
+            }
+        }
+    }
+
+    /**
+     * Locks the queue mutex, counts contention if stats are enabled
+     * 
+     * @return lock on the queue mutex
+     */
+    std::unique_lock<std::mutex> lock_queue() {
+        if (Stats::enabled) {
+            std::unique_lock<std::mutex> lock{mutex, std::try_to_lock};
+            if (!lock.owns_lock()) {
+                lock.lock();
+                counters.on_contention();
+            }
+            return lock;
+        }
+        return std::unique_lock<std::mutex>{mutex};
+    }
+
+    /**
+     * Updates the size mirror, must be called under the lock
+     * after elements were added or removed
+     */
+    void publish_size() {
+        size_mirror.store(delegate.size(), std::memory_order_relaxed);
+    }
+
+    template<typename S>
+    static auto reserve_storage(S& storage, size_t size, int) -> decltype(storage.reserve(size), void()) {
+        storage.reserve(size);
+    }
+
+    template<typename S>
+    static void reserve_storage(S&, size_t, long) { }
+
+    /**
+     * Converts timeout to deadline
+     * 
+     * @param timeout_millis timeout in milliseconds
+     * @return deadline
+     */
+    static std::chrono::steady_clock::time_point deadline_after(int32_t timeout_millis) {
+        return std::chrono::steady_clock::now() + std::chrono::milliseconds{timeout_millis};
+    }
+
+    /**
+     * Waits on empty queue, must be called under the lock
+     * 
+     * @param lock lock on the queue mutex
+     * @param deadline time point to wait until, nullptr will cause infinite wait
+     * @return false if queue is still empty, true otherwise
+     */
+    bool wait_not_empty(std::unique_lock<std::mutex>& lock, const std::chrono::steady_clock::time_point* deadline) {
+        if (delegate.empty()) {
+            auto predicate = [this] {
+                return !this->blocking || !this->delegate.empty();
+            };
+            auto start = Stats::enabled ? std::chrono::steady_clock::now() : 
+                    std::chrono::steady_clock::time_point();
+            waiting_consumers += 1;
+            if (nullptr != deadline) {
+                empty_cv.wait_until(lock, *deadline, predicate);
+            } else {
+                empty_cv.wait(lock, predicate);
+            }
+            waiting_consumers -= 1;
+            if (Stats::enabled) {
+                auto waited = std::chrono::steady_clock::now() - start;
+                counters.on_wait(std::chrono::duration_cast<std::chrono::nanoseconds>(waited).count());
+            }
+        }
+        return !delegate.empty();
+    }
+
+    /**
+     * Waits on empty queue, must be called under the lock
+     * 
+     * @param lock lock on the queue mutex
+     * @param timeout_millis max amount of milliseconds to wait on empty queue,
+     *        negative value will cause infinite wait
+     * @return false if queue is still empty, true otherwise
+     */
+    bool wait_not_empty(std::unique_lock<std::mutex>& lock, int32_t timeout_millis) {
+        if (timeout_millis < 0) {
+            return wait_not_empty(lock, nullptr);
+        }
+        auto deadline = deadline_after(timeout_millis);
+        return wait_not_empty(lock, &deadline);
+    }
+
+#ifdef __cpp_impl_coroutine
+    bool suspend_take(detail::awaiter_node<T>& node, std::coroutine_handle<> handle) {
+        detail::resume_list<T> ready;
+        auto lock = lock_queue();
+        if (!delegate.empty()) {
+            *node.record = std::move(delegate.front());
+            delegate.pop_front();
+            counters.on_dequeue(1);
+            publish_size();
+            notify_not_full(1, ready);
+            node.success = true;
+            return false;
+        }
+        if (!blocking) {
+            return false;
+        }
+        node.handle = handle;
+        take_awaiters.push_back(&node);
+        return true;
+    }
+
+    bool suspend_put(detail::awaiter_node<T>& node, std::coroutine_handle<> handle) {
+        detail::resume_list<T> ready;
+        auto lock = lock_queue();
+        if (0 == max_size || delegate.size() < max_size) {
+            delegate.emplace_back(std::move(*node.record));
+            counters.on_enqueue(1, delegate.size());
+            publish_size();
+            notify_not_empty(1, ready);
+            node.success = true;
+            return false;
+        }
+        if (!blocking) {
+            counters.on_reject();
+            return false;
+        }
+        node.handle = handle;
+        put_awaiters.push_back(&node);
+        return true;
+    }
+#endif // __cpp_impl_coroutine
+
+    template<typename R>
+    bool put_internal(R&& record, const std::chrono::steady_clock::time_point* deadline) {
+        detail::resume_list<T> ready;
+        auto lock = lock_queue();
+        if (0 != max_size && delegate.size() >= max_size) {
+            auto predicate = [this] {
+                return !this->blocking || this->delegate.size() < this->max_size;
+            };
+            waiting_producers += 1;
+            if (nullptr != deadline) {
+                full_cv.wait_until(lock, *deadline, predicate);
+            } else {
+                full_cv.wait(lock, predicate);
+            }
+            waiting_producers -= 1;
+            if (delegate.size() >= max_size) {
+                counters.on_reject();
+                return false;
+            }
+        }
+        delegate.emplace_back(std::forward<R>(record));
+        counters.on_enqueue(1, delegate.size());
+        publish_size();
+        notify_not_empty(1, ready);
+        return true;
+    }
+
+    template<typename Deadline>
+    bool take_internal(T& record, Deadline deadline) {
+        detail::resume_list<T> ready;
+        auto lock = lock_queue();
+        if (wait_not_empty(lock, deadline)) {
+            record = std::move(delegate.front());
+            delegate.pop_front();
+            counters.on_dequeue(1);
+            publish_size();
+            notify_not_full(1, ready);
+            return true;
+        } else {
+            return false;
+        }
+    }
+
+    template<typename Container, typename Deadline>
+    size_t take_n_internal(Container& out, size_t max_count, Deadline deadline) {
+        detail::resume_list<T> ready;
+        auto lock = lock_queue();
+        if (0 == max_count || !wait_not_empty(lock, deadline)) {
+            return 0;
+        }
+        size_t count = 0;
+        while (count < max_count && !delegate.empty()) {
+            out.push_back(std::move(delegate.front()));
+            delegate.pop_front();
+            count += 1;
+        }
+        counters.on_dequeue(count);
+        publish_size();
+        notify_not_full(count, ready);
+        return count;
+    }
     
 public:
     /**
@@ -69,6 +368,11 @@ public:
      */
     typedef T value_type;
 
+    /**
+     * Type of storage
+     */
+    typedef Storage storage_type;
+
     /**
      * Constructor, optional bound size can be specified,
      * unbounded by default
@@ -76,7 +380,30 @@ public:
      * @param max_size queue size bound
      */
     blocking_queue(size_t max_size = 0) : 
-    max_size(max_size) { }
+    storage_alloc(delegate.get_allocator()),
+    max_size(max_size),
+    size_mirror(0) {
+        if (max_size > 0) {
+            reserve_storage(delegate, max_size, 0);
+        }
+    }
+
+    /**
+     * Constructor, allows to specify preconfigured (e.g. with custom
+     * allocator) storage, storage must be empty
+     * 
+     * @param max_size queue size bound, zero for unbounded queue
+     * @param storage storage for queue elements
+     */
+    blocking_queue(size_t max_size, Storage&& storage) :
+    delegate(std::move(storage)),
+    storage_alloc(delegate.get_allocator()),
+    max_size(max_size),
+    size_mirror(0) {
+        if (max_size > 0) {
+            reserve_storage(delegate, max_size, 0);
+        }
+    }
 
     /**
      * Emplace a value at the end of the queue
@@ -86,20 +413,66 @@ public:
      */
     template<typename ...Args>
     bool emplace(Args&&... record_args) {
-        std::lock_guard<std::mutex> guard{mutex};
-        auto size = delegate.size();
-        if (0 == max_size || size < max_size) {
+        detail::resume_list<T> ready;
+        auto lock = lock_queue();
+        if (0 == max_size || delegate.size() < max_size) {
             delegate.emplace_back(std::forward<Args>(record_args)...);
-            if (0 == size) {
-                // notify_one causes deadlocks here
-                empty_cv.notify_all();
-            }
+            counters.on_enqueue(1, delegate.size());
+            publish_size();
+            notify_not_empty(1, ready);
             return true;
         } else {
+            counters.on_reject();
             return false;
         }
     }
     
+    /**
+     * Put a value at the end of the queue. This method will wait on full
+     * queue infinitely (by default), or up to specified amount of milliseconds
+     * 
+     * @param record value to move (or copy) into the queue
+     * @param timeout_millis max amount of milliseconds to wait on full queue,
+     *        negative value (supplied by default) will cause infinite wait
+     * @return false if the queue was full after timeout or was unblocked, true otherwise
+     */
+    template<typename R>
+    bool put(R&& record, int32_t timeout_millis = -1) {
+        if (timeout_millis < 0) {
+            return put_internal(std::forward<R>(record), nullptr);
+        }
+        auto deadline = deadline_after(timeout_millis);
+        return put_internal(std::forward<R>(record), &deadline);
+    }
+
+    /**
+     * Put a value at the end of the queue. This method will wait on full
+     * queue up to the specified deadline
+     * 
+     * @param record value to move (or copy) into the queue
+     * @param deadline time point to wait until
+     * @return false if the queue was full at deadline or was unblocked, true otherwise
+     */
+    template<typename R>
+    bool put_until(R&& record, const std::chrono::steady_clock::time_point& deadline) {
+        return put_internal(std::forward<R>(record), &deadline);
+    }
+
+    /**
+     * Put a value at the end of the queue. This method will wait on full
+     * queue up to the specified amount of time
+     * 
+     * @param record value to move (or copy) into the queue
+     * @param timeout max amount of time to wait on full queue
+     * @return false if the queue was full after timeout or was unblocked, true otherwise
+     */
+    template<typename R, typename Rep, typename Period>
+    bool put_for(R&& record, const std::chrono::duration<Rep, Period>& timeout) {
+        auto deadline = std::chrono::steady_clock::now() + 
+                std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout);
+        return put_internal(std::forward<R>(record), &deadline);
+    }
+
     /**
      * Emplace the values from specified range into
      * this queue
@@ -110,17 +483,22 @@ public:
     template<typename Range,
             class = typename std::enable_if<!std::is_lvalue_reference<Range>::value>::type>
     size_t emplace_range(Range&& range) {
-        std::lock_guard<std::mutex> guard{mutex};
-        auto size = delegate.size();
+        detail::resume_list<T> ready;
+        auto lock = lock_queue();
+        auto origin_size = delegate.size();
         for (auto&& el : range) {
-            if (0 == max_size || size < max_size) {
+            if (0 == max_size || delegate.size() < max_size) {
                 delegate.emplace_back(std::move(el));
-                size += 1;
             } else {
+                counters.on_reject();
                 break;
             }
         }
-        return delegate.size() - size;
+        auto count = delegate.size() - origin_size;
+        counters.on_enqueue(count, delegate.size());
+        publish_size();
+        notify_not_empty(count, ready);
+        return count;
     }
 
     /**
@@ -132,16 +510,22 @@ public:
      */
     template<typename Range>
     size_t emplace_range(Range& range) {
-        std::lock_guard<std::mutex> guard{mutex};
+        detail::resume_list<T> ready;
+        auto lock = lock_queue();
         auto origin_size = delegate.size();
         for (auto& el : range) {
             if (0 == max_size || delegate.size() < max_size) {
                 delegate.emplace_back(el);
             } else {
+                counters.on_reject();
                 break;
             }
         }
-        return delegate.size() - origin_size;
+        auto count = delegate.size() - origin_size;
+        counters.on_enqueue(count, delegate.size());
+        publish_size();
+        notify_not_empty(count, ready);
+        return count;
     }
 
     /**
@@ -152,10 +536,14 @@ public:
      * @return returns false if queue was empty, true otherwise
      */
     bool poll(T& record) {
-        std::lock_guard<std::mutex> guard{mutex};
+        detail::resume_list<T> ready;
+        auto lock = lock_queue();
         if (!delegate.empty()) {
             record = std::move(delegate.front());
             delegate.pop_front();
+            counters.on_dequeue(1);
+            publish_size();
+            notify_not_full(1, ready);
             return true;
         } else {
             return false;
@@ -171,7 +559,8 @@ public:
      */
     template<typename Func>
     size_t consume(Func func) {
-        std::lock_guard<std::mutex> guard{mutex};
+        detail::resume_list<T> ready;
+        auto lock = lock_queue();
         size_t count = 0;
         while(!delegate.empty()) {
             T record = std::move(delegate.front());
@@ -179,6 +568,9 @@ public:
             func(std::move(record));
             count += 1;
         }
+        counters.on_dequeue(count);
+        publish_size();
+        notify_not_full(count, ready);
         return count;
     }
 
@@ -193,43 +585,270 @@ public:
      * @return returns false if queue was empty after timeout, true otherwise
      */
     bool take(T& record, int32_t timeout_millis=-1) {
-        std::unique_lock<std::mutex> lock{mutex};
-        if (!delegate.empty()) {
-            record = std::move(delegate.front());
-            delegate.pop_front();
-            return true;
-        } else {
-            auto predicate = [this] {
-                return !this->blocking || !this->delegate.empty();
-            };
-            if (timeout_millis >= 0) {
-                empty_cv.wait_for(lock, std::chrono::milliseconds{timeout_millis}, predicate);
-            } else {
-                empty_cv.wait(lock, predicate);
-            }
-            if (!delegate.empty()) {
-                record = std::move(delegate.front());
-                delegate.pop_front();
-                return true;
-            } else {
-                return false;
-            }
+        return take_internal(record, timeout_millis);
+    }
+
+    /**
+     * Attempt to read the value at the front of the queue into a variable.
+     * This method will wait on empty queue up to the specified deadline,
+     * repeated calls with the same deadline do not extend the total wait time
+     * 
+     * @param record move (or copy) the value at the front of the queue to given variable
+     * @param deadline time point to wait until
+     * @return returns false if queue was empty at deadline, true otherwise
+     */
+    bool take_until(T& record, const std::chrono::steady_clock::time_point& deadline) {
+        return take_internal(record, &deadline);
+    }
+
+    /**
+     * Attempt to read the value at the front of the queue into a variable.
+     * This method will wait on empty queue up to the specified amount of time
+     * 
+     * @param record move (or copy) the value at the front of the queue to given variable
+     * @param timeout max amount of time to wait on empty queue
+     * @return returns false if queue was empty after timeout, true otherwise
+     */
+    template<typename Rep, typename Period>
+    bool take_for(T& record, const std::chrono::duration<Rep, Period>& timeout) {
+        auto deadline = std::chrono::steady_clock::now() + 
+                std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout);
+        return take_internal(record, &deadline);
+    }
+
+    /**
+     * Move up to the specified number of values from the front of the queue
+     * into the specified container under a single lock acquisition.
+     * This method will wait on empty queue infinitely (by default), 
+     * or up to specified amount of milliseconds
+     * 
+     * @param out container to append (using 'push_back') the values to
+     * @param max_count max number of values to move
+     * @param timeout_millis max amount of milliseconds to wait on empty queue,
+     *        negative value (supplied by default) will cause infinite wait
+     * @return number of values moved, zero if queue was empty after timeout
+     */
+    template<typename Container>
+    size_t take_n(Container& out, size_t max_count, int32_t timeout_millis = -1) {
+        return take_n_internal(out, max_count, timeout_millis);
+    }
+
+    /**
+     * Move up to the specified number of values from the front of the queue
+     * into the specified container under a single lock acquisition.
+     * This method will wait on empty queue up to the specified deadline
+     * 
+     * @param out container to append (using 'push_back') the values to
+     * @param max_count max number of values to move
+     * @param deadline time point to wait until
+     * @return number of values moved, zero if queue was empty at deadline
+     */
+    template<typename Container>
+    size_t take_n_until(Container& out, size_t max_count, const std::chrono::steady_clock::time_point& deadline) {
+        return take_n_internal(out, max_count, &deadline);
+    }
+
+    /**
+     * Move up to the specified number of values from the front of the queue
+     * into the specified container under a single lock acquisition.
+     * This method will wait on empty queue up to the specified amount of time
+     * 
+     * @param out container to append (using 'push_back') the values to
+     * @param max_count max number of values to move
+     * @param timeout max amount of time to wait on empty queue
+     * @return number of values moved, zero if queue was empty after timeout
+     */
+    template<typename Container, typename Rep, typename Period>
+    size_t take_n_for(Container& out, size_t max_count, const std::chrono::duration<Rep, Period>& timeout) {
+        auto deadline = std::chrono::steady_clock::now() + 
+                std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout);
+        return take_n_internal(out, max_count, &deadline);
+    }
+
+    /**
+     * Moves all the contents of this queue out under the lock and then
+     * passes them to the specified functor after unlocking. Queue continues
+     * with a new storage that is created (and reserved for bounded queue)
+     * before taking the lock. This method returns immediately.
+     * 
+     * @param func functor to consume contents
+     * @return number of elements consumed
+     */
+    template<typename Func>
+    size_t drain_to(Func func) {
+        Storage drained(storage_alloc);
+        if (max_size > 0) {
+            reserve_storage(drained, max_size, 0);
+        }
+        {
+            detail::resume_list<T> ready;
+            auto lock = lock_queue();
+            drained.swap(delegate);
+            counters.on_dequeue(drained.size());
+            publish_size();
+            notify_not_full(drained.size(), ready);
         }
+        size_t count = 0;
+        while (!drained.empty()) {
+            func(std::move(drained.front()));
+            drained.pop_front();
+            count += 1;
+        }
+        return count;
     }
     
     /**
      * Unblocks the queue allowing consumers to
-     * exit 'take' calls. Queue cannot be used
-     * for waiting on it after this call.
+     * exit 'take' calls and producers to exit 'put' calls.
+     * Queue cannot be used for waiting on it after this call.
      */
     void unblock() {
+#ifdef __cpp_impl_coroutine
+        detail::resume_list<T> ready;
+#endif // __cpp_impl_coroutine
         std::lock_guard<std::mutex> guard{mutex};
         this->blocking = false;
         if (delegate.empty()) {
             empty_cv.notify_all();
         }
+        full_cv.notify_all();
+#ifdef __cpp_impl_coroutine
+        while (!take_awaiters.empty()) {
+            ready.push_back(take_awaiters.pop_front());
+        }
+        while (!put_awaiters.empty()) {
+            counters.on_reject();
+            ready.push_back(put_awaiters.pop_front());
+        }
+#endif // __cpp_impl_coroutine
+    }
+
+#ifdef __cpp_impl_coroutine
+    /**
+     * Awaitable returned from "async_take"
+     */
+    class take_awaiter : private detail::awaiter_node<T> {
+        friend class blocking_queue;
+        blocking_queue& queue;
+
+        take_awaiter(blocking_queue& queue, T& record) :
+        queue(queue) {
+            this->record = std::addressof(record);
+        }
+
+    public:
+        /**
+         * Queue is always checked under the lock in "await_suspend"
+         * 
+         * @return false
+         */
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        /**
+         * Takes the value or suspends the coroutine on empty queue
+         * 
+         * @param handle calling coroutine
+         * @return false if the coroutine was not suspended, true otherwise
+         */
+        bool await_suspend(std::coroutine_handle<> handle) {
+            return queue.suspend_take(*this, handle);
+        }
+
+        /**
+         * Result of the operation
+         * 
+         * @return false if the queue was unblocked, true otherwise
+         */
+        bool await_resume() const noexcept {
+            return this->success;
+        }
+    };
+
+    /**
+     * Awaitable returned from "async_put"
+     */
+    class put_awaiter : private detail::awaiter_node<T> {
+        friend class blocking_queue;
+        blocking_queue& queue;
+        T value;
+
+        template<typename R>
+        put_awaiter(blocking_queue& queue, R&& record) :
+        queue(queue),
+        value(std::forward<R>(record)) { }
+
+    public:
+        /**
+         * Queue is always checked under the lock in "await_suspend"
+         * 
+         * @return false
+         */
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        /**
+         * Puts the value or suspends the coroutine on full queue
+         * 
+         * @param handle calling coroutine
+         * @return false if the coroutine was not suspended, true otherwise
+         */
+        bool await_suspend(std::coroutine_handle<> handle) {
+            this->record = std::addressof(value);
+            return queue.suspend_put(*this, handle);
+        }
+
+        /**
+         * Result of the operation
+         * 
+         * @return false if the queue was full and was unblocked, true otherwise
+         */
+        bool await_resume() const noexcept {
+            return this->success;
+        }
+    };
+
+    /**
+     * Read the value at the front of the queue into a variable, suspends
+     * the calling coroutine on empty queue. Suspended coroutine is resumed on
+     * the thread that added the value (or called "unblock") after the queue
+     * lock is released. Variable must be alive until the coroutine is resumed.
+     * 
+     * @param record move (or copy) the value at the front of the queue to given variable
+     * @return awaitable, "co_await" returns false if the queue was unblocked, true otherwise
+     */
+    take_awaiter async_take(T& record) {
+        return take_awaiter(*this, record);
     }
+
+    /**
+     * Put a value at the end of the queue, suspends the calling coroutine
+     * on full queue. Suspended coroutine is resumed on the thread that
+     * removed the value (or called "unblock") after the queue lock is released.
+     * 
+     * @param record value to move (or copy) into the queue
+     * @return awaitable, "co_await" returns false if the queue was full
+     *         and was unblocked, true otherwise
+     */
+    template<typename R>
+    put_awaiter async_put(R&& record) {
+        return put_awaiter(*this, std::forward<R>(record));
+    }
+#endif // __cpp_impl_coroutine
     
+    /**
+     * Attaches this queue to the specified selector, selector is notified
+     * every time new elements are added, only one selector can be attached
+     * 
+     * @param selector selector to attach to, nullptr to detach
+     */
+    void set_selector(queue_selector* selector) {
+        std::lock_guard<std::mutex> guard{mutex};
+        this->selector = selector;
+    }
+
     /**
      * Checks whether this queue was unblocked
      * 
@@ -270,6 +889,37 @@ public:
         std::lock_guard<std::mutex> guard{mutex};
         return delegate.size();
     }
+
+    /**
+     * Returns the approximate number of entries in the queue without
+     * taking the lock, result may be stale when called concurrently
+     * with other operations
+     * 
+     * @return number of entries in the queue
+     */
+    size_t size_guess() const {
+        return size_mirror.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Check if the queue is empty without taking the lock, result may be
+     * stale when called concurrently with other operations
+     * 
+     * @return whether queue is empty
+     */
+    bool empty_guess() const {
+        return 0 == size_guess();
+    }
+
+    /**
+     * Accessor for queue counters, "snapshot" can be called on them
+     * without locking the queue
+     * 
+     * @return queue counters
+     */
+    const Stats& stats() const {
+        return counters;
+    }
 };
 
 }
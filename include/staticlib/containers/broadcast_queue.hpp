@@ -0,0 +1,312 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   broadcast_queue.hpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#ifndef STATICLIB_CONTAINERS_BROADCAST_QUEUE_HPP
+#define	STATICLIB_CONTAINERS_BROADCAST_QUEUE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "staticlib/containers/detail/cache_line.hpp"
+#include "staticlib/containers/detail/ring_storage.hpp"
+
+namespace staticlib {
+namespace containers {
+
+/**
+ * Single producer multiple consumers lock-free ring, every element is
+ * delivered to every consumer. Each element is written once, consumers
+ * have independent read cursors (identified by index) and read elements
+ * in place, producer is gated by the slowest cursor. Element is destroyed
+ * when its slot is reused or when the ring is destroyed. Indices and memory
+ * orderings follow "producer_consumer_queue". Each consumer method with
+ * index "idx" can be called only by the thread of that consumer.
+ */
+template<typename T>
+class broadcast_queue {
+    struct cursor {
+        char pad0[detail::cache_line_size];
+        std::atomic<uint64_t> read_index;
+        uint64_t write_index_cache;
+        char pad1[detail::cache_line_size];
+
+        cursor() :
+        read_index(0),
+        write_index_cache(0) { }
+    };
+
+    // owned by producer
+    char pad0[detail::cache_line_size];
+    detail::ring_storage<T, 0> records;
+    std::atomic<uint64_t> write_index;
+    uint64_t min_read_cache;
+    // elements before this index are destroyed
+    uint64_t destroyed_index;
+
+    // owned by consumers
+    const size_t cursors_count;
+    std::unique_ptr<cursor[]> cursors;
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other instance
+     */
+    broadcast_queue(const broadcast_queue&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other instance
+     * @return reference to self
+     */
+    broadcast_queue& operator=(const broadcast_queue&) = delete;
+
+    uint64_t load_min_read(uint64_t current_write) const {
+        uint64_t res = current_write;
+        for (size_t i = 0; i < cursors_count; i++) {
+            uint64_t read = cursors[i].read_index.load(std::memory_order_acquire);
+            if (read < res) {
+                res = read;
+            }
+        }
+        return res;
+    }
+
+    bool has_space(uint64_t current_write) {
+        if (current_write - min_read_cache == records.capacity()) {
+            min_read_cache = load_min_read(current_write);
+            if (current_write - min_read_cache == records.capacity()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool has_records(cursor& cur, uint64_t current_read) {
+        if (current_read == cur.write_index_cache) {
+            cur.write_index_cache = write_index.load(std::memory_order_acquire);
+            if (current_read == cur.write_index_cache) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // previous element in the slot was read by all consumers
+    void release_slot(uint64_t current_write) {
+        if (current_write - destroyed_index > records.mask()) {
+            records.slot(destroyed_index)->~T();
+            destroyed_index += 1;
+        }
+    }
+
+public:
+    /**
+     * Type of elements
+     */
+    typedef T value_type;
+
+    /**
+     * Constructor
+     *
+     * @param size max number of elements not yet read by the slowest consumer
+     * @param consumers_count number of consumers
+     */
+    broadcast_queue(uint32_t size, size_t consumers_count) :
+    records(size > 0 ? size : 1),
+    write_index(0),
+    min_read_cache(0),
+    destroyed_index(0),
+    cursors_count(consumers_count > 0 ? consumers_count : 1),
+    cursors(new cursor[cursors_count]) { }
+
+    /**
+     * Destructor, destroys all elements that are still kept in the ring
+     */
+    ~broadcast_queue() {
+        uint64_t end = write_index.load(std::memory_order_acquire);
+        for (uint64_t i = destroyed_index; i < end; i++) {
+            records.slot(i)->~T();
+        }
+    }
+
+    /**
+     * Emplace a value at the end of the ring, can be called only by producer
+     *
+     * @param recordArgs constructor arguments for queue element
+     * @return false if the slowest consumer has not read the
+     *         oldest element yet, true otherwise
+     */
+    template<class ...Args>
+    bool emplace(Args&&... record_args) {
+        auto const current_write = write_index.load(std::memory_order_relaxed);
+        if (!has_space(current_write)) {
+            return false;
+        }
+        release_slot(current_write);
+        new (records.slot(current_write)) T(std::forward<Args>(record_args)...);
+        write_index.store(current_write + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Attempt to copy the value at the front of the ring for the specified
+     * consumer into a variable and advance the cursor of this consumer,
+     * can be called only by that consumer
+     *
+     * @param idx consumer index
+     * @param record copy the value at the front of the ring to given variable
+     * @return false if there are no new elements for this consumer, true otherwise
+     */
+    bool poll(size_t idx, T& record) {
+        cursor& cur = cursors[idx];
+        auto const current_read = cur.read_index.load(std::memory_order_relaxed);
+        if (!has_records(cur, current_read)) {
+            return false;
+        }
+        record = *records.slot(current_read);
+        cur.read_index.store(current_read + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Pass all the elements currently available to the specified consumer
+     * to the functor without copying them, cursor is advanced once after
+     * all elements were passed, can be called only by that consumer
+     *
+     * @param idx consumer index
+     * @param func functor accepting const reference to the element
+     * @return number of elements consumed
+     */
+    template<typename Func>
+    size_t consume(size_t idx, Func func) {
+        cursor& cur = cursors[idx];
+        auto current_read = cur.read_index.load(std::memory_order_relaxed);
+        cur.write_index_cache = write_index.load(std::memory_order_acquire);
+        size_t count = 0;
+        try {
+            while (current_read != cur.write_index_cache) {
+                const T& record = *records.slot(current_read);
+                current_read += 1;
+                func(record);
+                count += 1;
+            }
+        } catch (...) {
+            cur.read_index.store(current_read, std::memory_order_release);
+            throw;
+        }
+        cur.read_index.store(current_read, std::memory_order_release);
+        return count;
+    }
+
+    /**
+     * Returns a pointer to the value at the front of the ring for the
+     * specified consumer (for use in-place) or nullptr if there are
+     * no new elements, can be called only by that consumer
+     *
+     * @param idx consumer index
+     * @return pointer to the value at the front of the ring
+     */
+    const T* front_ptr(size_t idx) {
+        cursor& cur = cursors[idx];
+        auto const current_read = cur.read_index.load(std::memory_order_relaxed);
+        if (!has_records(cur, current_read)) {
+            return nullptr;
+        }
+        return records.slot(current_read);
+    }
+
+    /**
+     * Advance the cursor of the specified consumer past the value at the front,
+     * can be called only by that consumer after successful "front_ptr" call
+     *
+     * @param idx consumer index
+     */
+    void pop_front(size_t idx) {
+        cursor& cur = cursors[idx];
+        auto const current_read = cur.read_index.load(std::memory_order_relaxed);
+        cur.read_index.store(current_read + 1, std::memory_order_release);
+    }
+
+    /**
+     * Check if there are no new elements for the specified consumer,
+     * result may be stale when called concurrently with the producer
+     *
+     * @param idx consumer index
+     * @return whether there are no new elements for this consumer
+     */
+    bool is_empty(size_t idx) const {
+        return 0 == size_guess(idx);
+    }
+
+    /**
+     * Check if the slowest consumer has not read the oldest element,
+     * result may be stale when called concurrently with other operations
+     *
+     * @return whether ring is full
+     */
+    bool is_full() const {
+        auto const current_write = write_index.load(std::memory_order_acquire);
+        return current_write - load_min_read(current_write) >= records.capacity();
+    }
+
+    /**
+     * Returns the number of elements not yet read by the specified consumer,
+     * result may be stale when called concurrently with the producer
+     *
+     * @param idx consumer index
+     * @return number of new elements for this consumer
+     */
+    size_t size_guess(size_t idx) const {
+        auto const read = cursors[idx].read_index.load(std::memory_order_acquire);
+        return static_cast<size_t>(write_index.load(std::memory_order_acquire) - read);
+    }
+
+    /**
+     * Accessor for the size specified at creation
+     *
+     * @return max number of elements not yet read by the slowest consumer
+     */
+    size_t max_size() const {
+        return static_cast<size_t>(records.capacity());
+    }
+
+    /**
+     * Accessor for number of consumers specified at creation
+     *
+     * @return number of consumers
+     */
+    size_t consumers_count() const {
+        return cursors_count;
+    }
+};
+
+}
+} // namespace
+
+#endif	/* STATICLIB_CONTAINERS_BROADCAST_QUEUE_HPP */
@@ -0,0 +1,292 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   conflating_queue.hpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#ifndef STATICLIB_CONTAINERS_CONFLATING_QUEUE_HPP
+#define	STATICLIB_CONTAINERS_CONFLATING_QUEUE_HPP
+
+#include <cstdint>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace staticlib {
+namespace containers {
+
+/**
+ * Optionally bounded FIFO queue of key-value pairs that keeps only
+ * the latest value for each key, synchronized access to all public methods.
+ * Supports multiple producers and multiple consumers, consumers will block
+ * on "take" from empty queue. New value for the key that is already
+ * in the queue replaces the old value and keeps its position, so
+ * the queue size is bound by the number of distinct keys.
+ */
+template<typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class conflating_queue {
+public:
+    /**
+     * Type of elements
+     */
+    typedef std::pair<K, V> value_type;
+
+private:
+    mutable std::mutex mutex;
+    std::condition_variable empty_cv;
+    std::list<value_type> entries;
+    std::unordered_map<K, typename std::list<value_type>::iterator, Hash, KeyEqual> index;
+    size_t max_size;
+    uint64_t conflated = 0;
+    size_t waiting_consumers = 0;
+    bool blocking = true;
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other instance
+     */
+    conflating_queue(const conflating_queue&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other instance
+     * @return reference to self
+     */
+    conflating_queue& operator=(const conflating_queue&) = delete;
+
+    /**
+     * Removes the entry at the front of the queue, must be called under the lock
+     *
+     * @param record move the entry at the front of the queue to given variable
+     */
+    void pop_front(value_type& record) {
+        index.erase(entries.front().first);
+        record = std::move(entries.front());
+        entries.pop_front();
+    }
+
+    /**
+     * Waits on empty queue, must be called under the lock
+     *
+     * @param lock lock on the queue mutex
+     * @param timeout_millis max amount of milliseconds to wait on empty queue,
+     *        negative value will cause infinite wait
+     * @return false if queue is still empty, true otherwise
+     */
+    bool wait_not_empty(std::unique_lock<std::mutex>& lock, int32_t timeout_millis) {
+        if (entries.empty()) {
+            auto predicate = [this] {
+                return !this->blocking || !this->entries.empty();
+            };
+            waiting_consumers += 1;
+            if (timeout_millis >= 0) {
+                auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds{timeout_millis};
+                empty_cv.wait_until(lock, deadline, predicate);
+            } else {
+                empty_cv.wait(lock, predicate);
+            }
+            waiting_consumers -= 1;
+        }
+        return !entries.empty();
+    }
+
+public:
+    /**
+     * Constructor, optional bound for the number of distinct keys
+     * can be specified, unbounded by default
+     *
+     * @param max_size max number of distinct keys in the queue
+     */
+    conflating_queue(size_t max_size = 0) :
+    max_size(max_size) {
+        if (max_size > 0) {
+            index.reserve(max_size);
+        }
+    }
+
+    /**
+     * Add a value for the specified key, if the queue already has a value
+     * for this key, it is replaced and keeps its position in the queue
+     *
+     * @param key key
+     * @param value value to move (or copy) into the queue
+     * @return false if the key was not in the queue and the queue was full,
+     *         true otherwise
+     */
+    template<typename KR, typename VR>
+    bool emplace(KR&& key, VR&& value) {
+        std::lock_guard<std::mutex> guard{mutex};
+        auto it = index.find(key);
+        if (index.end() != it) {
+            it->second->second = std::forward<VR>(value);
+            conflated += 1;
+            return true;
+        }
+        if (0 != max_size && entries.size() >= max_size) {
+            return false;
+        }
+        entries.emplace_back(std::forward<KR>(key), std::forward<VR>(value));
+        auto last = entries.end();
+        --last;
+        try {
+            index.emplace(last->first, last);
+        } catch (...) {
+            entries.pop_back();
+            throw;
+        }
+        if (waiting_consumers > 0) {
+            empty_cv.notify_one();
+        }
+        return true;
+    }
+
+    /**
+     * Attempt to read the entry at the front of the queue into a variable.
+     * This method returns immediately.
+     *
+     * @param record move the entry at the front of the queue to given variable
+     * @return returns false if queue was empty, true otherwise
+     */
+    bool poll(value_type& record) {
+        std::lock_guard<std::mutex> guard{mutex};
+        if (!entries.empty()) {
+            pop_front(record);
+            return true;
+        } else {
+            return false;
+        }
+    }
+
+    /**
+     * Attempt to read the entry at the front of the queue into a variable.
+     * This method will wait on empty queue infinitely (by default),
+     * or up to specified amount of milliseconds
+     *
+     * @param record move the entry at the front of the queue to given variable
+     * @param timeout_millis max amount of milliseconds to wait on empty queue,
+     *        negative value (supplied by default) will cause infinite wait
+     * @return returns false if queue was empty after timeout, true otherwise
+     */
+    bool take(value_type& record, int32_t timeout_millis = -1) {
+        std::unique_lock<std::mutex> lock{mutex};
+        if (wait_not_empty(lock, timeout_millis)) {
+            pop_front(record);
+            return true;
+        } else {
+            return false;
+        }
+    }
+
+    /**
+     * Consume all the contents of this queue into
+     * specified functor
+     *
+     * @param func functor accepting "value_type" to consume contents
+     * @return number of entries consumed
+     */
+    template<typename Func>
+    size_t consume(Func func) {
+        std::list<value_type> drained;
+        {
+            std::lock_guard<std::mutex> guard{mutex};
+            drained.swap(entries);
+            index.clear();
+        }
+        size_t count = 0;
+        for (auto& en : drained) {
+            func(std::move(en));
+            count += 1;
+        }
+        return count;
+    }
+
+    /**
+     * Unblocks the queue allowing consumers to exit 'take' calls.
+     * Queue cannot be used for waiting on it after this call.
+     */
+    void unblock() {
+        std::lock_guard<std::mutex> guard{mutex};
+        this->blocking = false;
+        empty_cv.notify_all();
+    }
+
+    /**
+     * Checks whether this queue was unblocked
+     *
+     * @return whether this queue was unblocked
+     */
+    bool is_blocking() const {
+        std::lock_guard<std::mutex> guard{mutex};
+        return blocking;
+    }
+
+    /**
+     * Check if the queue is empty
+     *
+     * @return whether queue is empty
+     */
+    bool is_empty() const {
+        std::lock_guard<std::mutex> guard{mutex};
+        return entries.empty();
+    }
+
+    /**
+     * Check if the queue is full, always false for unbounded queue
+     *
+     * @return whether queue is full
+     */
+    bool is_full() const {
+        std::lock_guard<std::mutex> guard{mutex};
+        if (0 == max_size) return false;
+        return entries.size() >= max_size;
+    }
+
+    /**
+     * Returns the number of entries (distinct keys) in the queue
+     *
+     * @return number of entries in the queue
+     */
+    size_t size() const {
+        std::lock_guard<std::mutex> guard{mutex};
+        return entries.size();
+    }
+
+    /**
+     * Returns the number of values that replaced older values
+     * for the same key since creation
+     *
+     * @return number of conflated values
+     */
+    uint64_t conflated_count() const {
+        std::lock_guard<std::mutex> guard{mutex};
+        return conflated;
+    }
+};
+
+}
+} // namespace
+
+#endif	/* STATICLIB_CONTAINERS_CONFLATING_QUEUE_HPP */
@@ -0,0 +1,321 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   delay_queue.hpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#ifndef STATICLIB_CONTAINERS_DELAY_QUEUE_HPP
+#define	STATICLIB_CONTAINERS_DELAY_QUEUE_HPP
+
+#include <cstdint>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <utility>
+
+#include "staticlib/containers/detail/dary_heap.hpp"
+
+namespace staticlib {
+namespace containers {
+
+/**
+ * Unbounded queue of delayed elements with synchronized access to all
+ * public methods. Supports multiple producers and multiple consumers.
+ * Each element carries a "steady_clock" deadline and can be taken only
+ * after its deadline has passed, elements are taken in deadline order,
+ * elements with equal deadlines are taken in insertion order.
+ * Consumers will block on "take" until the earliest deadline, insertion
+ * of the element with an earlier deadline wakes up the consumer.
+ * Elements are kept in 4-ary heap.
+ */
+template<typename T>
+class delay_queue {
+public:
+    /**
+     * Type of elements
+     */
+    typedef T value_type;
+
+    /**
+     * Type of deadlines
+     */
+    typedef std::chrono::steady_clock::time_point time_point;
+
+private:
+    struct entry {
+        time_point deadline;
+        uint64_t seq;
+        T record;
+
+        template<typename... Args>
+        entry(time_point deadline, uint64_t seq, Args&&... record_args) :
+        deadline(deadline),
+        seq(seq),
+        record(std::forward<Args>(record_args)...) { }
+    };
+
+    // earliest deadline on top of the heap
+    struct later_deadline {
+        bool operator()(const entry& a, const entry& b) const {
+            if (a.deadline != b.deadline) {
+                return a.deadline > b.deadline;
+            }
+            return a.seq > b.seq;
+        }
+    };
+
+    mutable std::mutex mutex;
+    std::condition_variable ready_cv;
+    detail::dary_heap<entry, later_deadline> heap;
+    uint64_t seq = 0;
+    size_t waiting_consumers = 0;
+    bool blocking = true;
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other instance
+     */
+    delay_queue(const delay_queue&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other instance
+     * @return reference to self
+     */
+    delay_queue& operator=(const delay_queue&) = delete;
+
+    /**
+     * Checks whether the top element is expired, must be called under the lock
+     *
+     * @param now current time
+     * @return whether the top element can be taken
+     */
+    bool has_ready(time_point now) const {
+        return !heap.empty() && heap.top().deadline <= now;
+    }
+
+    /**
+     * Removes the top element, must be called under the lock
+     *
+     * @return top element
+     */
+    T pop_ready() {
+        T res = std::move(heap.pop().record);
+        // other consumers may wait on the removed deadline or without
+        // a deadline at all, one of them needs to re-arm its wait
+        if (!heap.empty() && waiting_consumers > 0) {
+            ready_cv.notify_one();
+        }
+        return res;
+    }
+
+    /**
+     * Waits until the top element is expired, must be called under the lock
+     *
+     * @param lock lock on the queue mutex
+     * @param timeout_millis max amount of milliseconds to wait,
+     *        negative value will cause infinite wait
+     * @return false if there were no expired elements after timeout
+     *         or queue was unblocked, true otherwise
+     */
+    bool wait_ready(std::unique_lock<std::mutex>& lock, int32_t timeout_millis) {
+        auto now = std::chrono::steady_clock::now();
+        auto timeout = now + std::chrono::milliseconds{timeout_millis > 0 ? timeout_millis : 0};
+        for (;;) {
+            if (has_ready(now)) {
+                return true;
+            }
+            if (!blocking || (timeout_millis >= 0 && now >= timeout)) {
+                return false;
+            }
+            waiting_consumers += 1;
+            if (!heap.empty() && (timeout_millis < 0 || heap.top().deadline < timeout)) {
+                // heap storage may be reallocated while waiting
+                time_point deadline = heap.top().deadline;
+                ready_cv.wait_until(lock, deadline);
+            } else if (timeout_millis >= 0) {
+                ready_cv.wait_until(lock, timeout);
+            } else {
+                ready_cv.wait(lock);
+            }
+            waiting_consumers -= 1;
+            now = std::chrono::steady_clock::now();
+        }
+    }
+
+public:
+    /**
+     * Constructor
+     */
+    delay_queue() { }
+
+    /**
+     * Emplace a value into the queue, value can be taken after the specified deadline
+     *
+     * @param deadline point in time after which value can be taken
+     * @param recordArgs constructor arguments for queue element
+     */
+    template<typename ...Args>
+    void emplace_at(time_point deadline, Args&&... record_args) {
+        std::lock_guard<std::mutex> guard{mutex};
+        bool earliest = heap.empty() || deadline < heap.top().deadline;
+        heap.emplace(deadline, seq, std::forward<Args>(record_args)...);
+        seq += 1;
+        // consumers wait on the previous top deadline, one of them
+        // needs to re-arm its wait
+        if (earliest && waiting_consumers > 0) {
+            ready_cv.notify_one();
+        }
+    }
+
+    /**
+     * Emplace a value into the queue, value can be taken after the specified delay
+     *
+     * @param delay amount of time after which value can be taken
+     * @param recordArgs constructor arguments for queue element
+     */
+    template<typename Rep, typename Period, typename ...Args>
+    void emplace_after(const std::chrono::duration<Rep, Period>& delay, Args&&... record_args) {
+        auto deadline = std::chrono::steady_clock::now() +
+                std::chrono::duration_cast<std::chrono::steady_clock::duration>(delay);
+        emplace_at(deadline, std::forward<Args>(record_args)...);
+    }
+
+    /**
+     * Attempt to read the expired value with the earliest deadline
+     * into a variable. This method returns immediately.
+     *
+     * @param record move (or copy) the expired value to given variable
+     * @return returns false if queue had no expired values, true otherwise
+     */
+    bool poll(T& record) {
+        std::lock_guard<std::mutex> guard{mutex};
+        if (has_ready(std::chrono::steady_clock::now())) {
+            record = pop_ready();
+            return true;
+        } else {
+            return false;
+        }
+    }
+
+    /**
+     * Attempt to read the expired value with the earliest deadline
+     * into a variable. This method will wait until the earliest deadline
+     * infinitely (by default), or up to specified amount of milliseconds
+     *
+     * @param record move (or copy) the expired value to given variable
+     * @param timeout_millis max amount of milliseconds to wait,
+     *        negative value (supplied by default) will cause infinite wait
+     * @return returns false if queue had no expired values after timeout
+     *         or was unblocked, true otherwise
+     */
+    bool take(T& record, int32_t timeout_millis = -1) {
+        std::unique_lock<std::mutex> lock{mutex};
+        if (wait_ready(lock, timeout_millis)) {
+            record = pop_ready();
+            return true;
+        } else {
+            return false;
+        }
+    }
+
+    /**
+     * Consume all the expired contents of this queue into
+     * specified functor in deadline order
+     *
+     * @param func functor to consume contents
+     * @return number of elements consumed
+     */
+    template<typename Func>
+    size_t consume(Func func) {
+        std::lock_guard<std::mutex> guard{mutex};
+        auto now = std::chrono::steady_clock::now();
+        size_t count = 0;
+        while (has_ready(now)) {
+            func(pop_ready());
+            count += 1;
+        }
+        return count;
+    }
+
+    /**
+     * Accessor for the earliest deadline in the queue
+     *
+     * @param deadline earliest deadline is written to this variable
+     * @return false if queue was empty, true otherwise
+     */
+    bool next_deadline(time_point& deadline) const {
+        std::lock_guard<std::mutex> guard{mutex};
+        if (!heap.empty()) {
+            deadline = heap.top().deadline;
+            return true;
+        } else {
+            return false;
+        }
+    }
+
+    /**
+     * Unblocks the queue allowing consumers to exit 'take' calls.
+     * Queue cannot be used for waiting on it after this call.
+     */
+    void unblock() {
+        std::lock_guard<std::mutex> guard{mutex};
+        this->blocking = false;
+        ready_cv.notify_all();
+    }
+
+    /**
+     * Checks whether this queue was unblocked
+     *
+     * @return whether this queue was unblocked
+     */
+    bool is_blocking() const {
+        std::lock_guard<std::mutex> guard{mutex};
+        return blocking;
+    }
+
+    /**
+     * Check if the queue is empty, queue with pending
+     * (not yet expired) elements is not empty
+     *
+     * @return whether queue is empty
+     */
+    bool is_empty() const {
+        std::lock_guard<std::mutex> guard{mutex};
+        return heap.empty();
+    }
+
+    /**
+     * Returns the number of entries (both expired and pending) in the queue
+     *
+     * @return number of entries in the queue
+     */
+    size_t size() const {
+        std::lock_guard<std::mutex> guard{mutex};
+        return heap.size();
+    }
+};
+
+}
+} // namespace
+
+#endif	/* STATICLIB_CONTAINERS_DELAY_QUEUE_HPP */
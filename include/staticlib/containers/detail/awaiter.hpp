@@ -0,0 +1,171 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   awaiter.hpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#ifndef STATICLIB_CONTAINERS_DETAIL_AWAITER_HPP
+#define	STATICLIB_CONTAINERS_DETAIL_AWAITER_HPP
+
+#include <atomic>
+
+#ifdef __cpp_impl_coroutine
+#include <coroutine>
+#endif // __cpp_impl_coroutine
+
+namespace staticlib {
+namespace containers {
+namespace detail {
+
+#ifdef __cpp_impl_coroutine
+
+/**
+ * Suspended coroutine waiting on the queue, lives in the coroutine frame
+ */
+template<typename T>
+struct awaiter_node {
+    awaiter_node* next = nullptr;
+    std::coroutine_handle<> handle;
+    // destination for "take", source for "put"
+    T* record = nullptr;
+    bool success = false;
+};
+
+/**
+ * Intrusive FIFO list of suspended coroutines,
+ * must be accessed under the queue lock
+ */
+template<typename T>
+class awaiter_list {
+    awaiter_node<T>* head = nullptr;
+    awaiter_node<T>* tail = nullptr;
+
+public:
+    bool empty() const {
+        return nullptr == head;
+    }
+
+    void push_back(awaiter_node<T>* node) {
+        node->next = nullptr;
+        if (nullptr == tail) {
+            head = node;
+        } else {
+            tail->next = node;
+        }
+        tail = node;
+    }
+
+    awaiter_node<T>* pop_front() {
+        awaiter_node<T>* res = head;
+        head = res->next;
+        if (nullptr == head) {
+            tail = nullptr;
+        }
+        return res;
+    }
+};
+
+/**
+ * Coroutines that became ready under the queue lock, must be declared
+ * before the lock, so coroutines are resumed after unlocking
+ */
+template<typename T>
+class resume_list {
+    awaiter_list<T> ready;
+
+    resume_list(const resume_list&) = delete;
+
+    resume_list& operator=(const resume_list&) = delete;
+
+public:
+    resume_list() { }
+
+    ~resume_list() {
+        while (!ready.empty()) {
+            // node is destroyed with the frame after resume
+            ready.pop_front()->handle.resume();
+        }
+    }
+
+    void push_back(awaiter_node<T>* node) {
+        ready.push_back(node);
+    }
+};
+
+/**
+ * Single suspended coroutine of the lock-free queue side
+ * (only one consumer or one producer can wait)
+ */
+template<typename T>
+class awaiter_slot {
+    std::atomic<awaiter_node<T>*> waiter{nullptr};
+
+public:
+    /**
+     * Publishes the waiter, condition is re-checked after publishing
+     *
+     * @param node waiter
+     * @param ready condition the waiter is waiting for
+     * @return false if condition became true and the waiter was taken back,
+     *         true if coroutine must stay suspended
+     */
+    template<typename Predicate>
+    bool suspend(awaiter_node<T>* node, Predicate ready) {
+        waiter.store(node, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (ready()) {
+            awaiter_node<T>* expected = node;
+            if (waiter.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel)) {
+                return false;
+            }
+            // notifier has taken it and will resume it
+        }
+        return true;
+    }
+
+    /**
+     * Resumes the waiter if there is one, must be called after the change
+     * of the condition followed by a sequentially consistent fence
+     */
+    void resume() {
+        if (nullptr != waiter.load(std::memory_order_relaxed)) {
+            awaiter_node<T>* node = waiter.exchange(nullptr, std::memory_order_acq_rel);
+            if (nullptr != node) {
+                node->handle.resume();
+            }
+        }
+    }
+};
+
+#else // __cpp_impl_coroutine
+
+/**
+ * Empty placeholder when coroutines are not supported
+ */
+template<typename T>
+class resume_list { };
+
+#endif // __cpp_impl_coroutine
+
+}
+}
+} // namespace
+
+#endif	/* STATICLIB_CONTAINERS_DETAIL_AWAITER_HPP */
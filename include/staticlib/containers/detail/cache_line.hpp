@@ -0,0 +1,48 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   cache_line.hpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#ifndef STATICLIB_CONTAINERS_DETAIL_CACHE_LINE_HPP
+#define	STATICLIB_CONTAINERS_DETAIL_CACHE_LINE_HPP
+
+#include <cstddef>
+
+// can be overridden for platforms with wider cache lines
+#ifndef STATICLIB_CONTAINERS_CACHE_LINE_SIZE
+#define STATICLIB_CONTAINERS_CACHE_LINE_SIZE 64
+#endif // STATICLIB_CONTAINERS_CACHE_LINE_SIZE
+
+namespace staticlib {
+namespace containers {
+namespace detail {
+
+/**
+ * Number of bytes used to separate the fields modified
+ * by different threads to prevent false sharing
+ */
+const size_t cache_line_size = STATICLIB_CONTAINERS_CACHE_LINE_SIZE;
+
+}
+}
+} // namespace
+
+#endif	/* STATICLIB_CONTAINERS_DETAIL_CACHE_LINE_HPP */
@@ -0,0 +1,236 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   dary_heap.hpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#ifndef STATICLIB_CONTAINERS_DETAIL_DARY_HEAP_HPP
+#define	STATICLIB_CONTAINERS_DETAIL_DARY_HEAP_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace staticlib {
+namespace containers {
+namespace detail {
+
+/**
+ * Implicit d-ary heap over a contiguous vector, not synchronized.
+ * With the default arity of 4, all children of the node usually share
+ * a cache line and the tree is half as deep as a binary heap.
+ * Ordering follows "std::priority_queue": top element is the element
+ * for which "compare(top, other)" is false for all other elements.
+ */
+template<typename T, typename Compare, size_t Arity = 4>
+class dary_heap {
+    static_assert(Arity >= 2, "heap arity must be at least 2");
+
+    std::vector<T> records;
+    Compare compare;
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other instance
+     */
+    dary_heap(const dary_heap&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other instance
+     * @return reference to self
+     */
+    dary_heap& operator=(const dary_heap&) = delete;
+
+    void sift_up(size_t idx) {
+        T record = std::move(records[idx]);
+        while (idx > 0) {
+            size_t parent = (idx - 1) / Arity;
+            if (!compare(records[parent], record)) {
+                break;
+            }
+            records[idx] = std::move(records[parent]);
+            idx = parent;
+        }
+        records[idx] = std::move(record);
+    }
+
+    void sift_down(size_t idx) {
+        size_t len = records.size();
+        T record = std::move(records[idx]);
+        for (;;) {
+            size_t first = idx * Arity + 1;
+            if (first >= len) {
+                break;
+            }
+            size_t last = first + Arity < len ? first + Arity : len;
+            size_t best = first;
+            for (size_t i = first + 1; i < last; i++) {
+                if (compare(records[best], records[i])) {
+                    best = i;
+                }
+            }
+            if (!compare(record, records[best])) {
+                break;
+            }
+            records[idx] = std::move(records[best]);
+            idx = best;
+        }
+        records[idx] = std::move(record);
+    }
+
+public:
+    /**
+     * Constructor
+     *
+     * @param compare comparison functor
+     */
+    explicit dary_heap(const Compare& compare = Compare()) :
+    compare(compare) { }
+
+    /**
+     * Add an element to the heap
+     *
+     * @param args constructor arguments for the element
+     */
+    template<typename... Args>
+    void emplace(Args&&... args) {
+        records.emplace_back(std::forward<Args>(args)...);
+        sift_up(records.size() - 1);
+    }
+
+    /**
+     * Accessor for the top element, heap must not be empty
+     *
+     * @return top element
+     */
+    const T& top() const {
+        return records.front();
+    }
+
+    /**
+     * Move the top element out and remove it from the heap,
+     * heap must not be empty
+     *
+     * @return top element
+     */
+    T pop() {
+        T res = std::move(records.front());
+        if (records.size() > 1) {
+            records.front() = std::move(records.back());
+            records.pop_back();
+            sift_down(0);
+        } else {
+            records.pop_back();
+        }
+        return res;
+    }
+
+    /**
+     * Finds the bottom element (the one that would be popped last),
+     * only leaves are checked, heap must not be empty
+     *
+     * @return index of the bottom element
+     */
+    size_t bottom_index() const {
+        size_t len = records.size();
+        size_t first_leaf = len > 1 ? (len - 2) / Arity + 1 : 0;
+        size_t res = first_leaf;
+        for (size_t i = first_leaf + 1; i < len; i++) {
+            if (compare(records[i], records[res])) {
+                res = i;
+            }
+        }
+        return res;
+    }
+
+    /**
+     * Accessor for the element with the specified index
+     *
+     * @param idx element index
+     * @return element
+     */
+    const T& at(size_t idx) const {
+        return records[idx];
+    }
+
+    /**
+     * Replaces the leaf element with the specified index,
+     * used to evict the bottom element
+     *
+     * @param idx index of the leaf element
+     * @param record new element
+     */
+    void replace_leaf(size_t idx, T&& record) {
+        records[idx] = std::move(record);
+        sift_up(idx);
+    }
+
+    /**
+     * Accessor for comparison functor
+     *
+     * @return comparison functor
+     */
+    const Compare& comparator() const {
+        return compare;
+    }
+
+    /**
+     * Pre-allocates space for the specified number of elements
+     *
+     * @param size number of elements
+     */
+    void reserve(size_t size) {
+        records.reserve(size);
+    }
+
+    /**
+     * Removes all elements
+     */
+    void clear() {
+        records.clear();
+    }
+
+    /**
+     * Check if the heap is empty
+     *
+     * @return whether heap is empty
+     */
+    bool empty() const {
+        return records.empty();
+    }
+
+    /**
+     * Returns the number of elements in the heap
+     *
+     * @return number of elements
+     */
+    size_t size() const {
+        return records.size();
+    }
+};
+
+}
+}
+} // namespace
+
+#endif	/* STATICLIB_CONTAINERS_DETAIL_DARY_HEAP_HPP */
@@ -0,0 +1,250 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   eventcount.hpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#ifndef STATICLIB_CONTAINERS_DETAIL_EVENTCOUNT_HPP
+#define	STATICLIB_CONTAINERS_DETAIL_EVENTCOUNT_HPP
+
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <emmintrin.h>
+#endif
+
+namespace staticlib {
+namespace containers {
+namespace detail {
+
+/**
+ * Hints the CPU that the calling thread is spinning
+ */
+inline void cpu_relax() {
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    _mm_pause();
+#elif defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+    __builtin_ia32_pause();
+#elif defined(__GNUC__) && (defined(__aarch64__) || defined(__arm__))
+    __asm__ __volatile__("yield" ::: "memory");
+#endif
+}
+
+/**
+ * Checks the predicate repeatedly, first spinning with pause instructions
+ * and then yielding the CPU to other threads
+ * 
+ * @param pred predicate to check
+ * @return true if predicate became true, false otherwise
+ */
+template<typename Predicate>
+bool spin_wait(Predicate pred) {
+    for (uint32_t i = 0; i < 256; i++) {
+        if (pred()) {
+            return true;
+        }
+        cpu_relax();
+    }
+    for (uint32_t i = 0; i < 16; i++) {
+        if (pred()) {
+            return true;
+        }
+        std::this_thread::yield();
+    }
+    return pred();
+}
+
+/**
+ * Allows lock-free data structures to park waiting threads. 
+ * Waiter must call "prepare_wait", re-check the condition and then 
+ * call either "cancel_wait" or "wait". Notifier must change the condition
+ * and then call "notify_one" or "notify_all", notification is cheap (one fence and one load)
+ * when no threads are parked.
+ */
+class eventcount {
+    std::atomic<uint32_t> waiters;
+    std::atomic<uint32_t> epoch;
+    std::mutex mutex;
+    std::condition_variable cv;
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    eventcount(const eventcount&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return reference to self
+     */
+    eventcount& operator=(const eventcount&) = delete;
+
+public:
+    /**
+     * Constructor
+     */
+    eventcount() :
+    waiters(0),
+    epoch(0) { }
+
+    /**
+     * Registers calling thread as a waiter, condition must be
+     * re-checked after this call
+     * 
+     * @return key to pass to "wait"
+     */
+    uint32_t prepare_wait() {
+        waiters.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return epoch.load(std::memory_order_seq_cst);
+    }
+
+    /**
+     * Unregisters calling thread after the re-checked condition
+     * was found to be satisfied
+     */
+    void cancel_wait() {
+        waiters.fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+    /**
+     * Parks calling thread until notification
+     * 
+     * @param key value returned from "prepare_wait"
+     */
+    void wait(uint32_t key) {
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            cv.wait(lock, [this, key] {
+                return key != this->epoch.load(std::memory_order_relaxed);
+            });
+        }
+        waiters.fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+    /**
+     * Parks calling thread until notification or until specified deadline
+     * 
+     * @param key value returned from "prepare_wait"
+     * @param deadline time point to wait until
+     * @return false if deadline was reached without notification, true otherwise
+     */
+    template<typename Clock, typename Duration>
+    bool wait_until(uint32_t key, const std::chrono::time_point<Clock, Duration>& deadline) {
+        bool notified = false;
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            notified = cv.wait_until(lock, deadline, [this, key] {
+                return key != this->epoch.load(std::memory_order_relaxed);
+            });
+        }
+        waiters.fetch_sub(1, std::memory_order_seq_cst);
+        return notified;
+    }
+
+    /**
+     * Wakes up all parked threads, does nothing if there are no
+     * parked threads
+     */
+    void notify_all() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (0 == waiters.load(std::memory_order_relaxed)) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> guard{mutex};
+            epoch.fetch_add(1, std::memory_order_seq_cst);
+        }
+        cv.notify_all();
+    }
+
+    /**
+     * Wakes up one parked thread, does nothing if there are no
+     * parked threads
+     */
+    void notify_one() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (0 == waiters.load(std::memory_order_relaxed)) {
+            return;
+        }
+        std::lock_guard<std::mutex> guard{mutex};
+        epoch.fetch_add(1, std::memory_order_seq_cst);
+        cv.notify_one();
+    }
+};
+
+/**
+ * Repeats the attempt until it succeeds, first spinning, then parking
+ * on the specified eventcount. Gives up on timeout or when the 
+ * "blocking" flag is cleared.
+ * 
+ * @param ec eventcount to park on
+ * @param blocking flag, waiting is stopped when it becomes false
+ * @param timeout_millis max amount of milliseconds to wait,
+ *        negative value will cause infinite wait
+ * @param attempt functor returning true on success
+ * @return true if attempt succeeded, false otherwise
+ */
+template<typename Attempt>
+bool spin_then_park(eventcount& ec, const std::atomic<bool>& blocking, int32_t timeout_millis,
+        Attempt attempt) {
+    if (attempt()) {
+        return true;
+    }
+    if (0 == timeout_millis) {
+        return false;
+    }
+    if (spin_wait(attempt)) {
+        return true;
+    }
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_millis);
+    for (;;) {
+        auto key = ec.prepare_wait();
+        if (attempt()) {
+            ec.cancel_wait();
+            return true;
+        }
+        if (!blocking.load(std::memory_order_acquire)) {
+            ec.cancel_wait();
+            return false;
+        }
+        if (timeout_millis >= 0) {
+            if (!ec.wait_until(key, deadline)) {
+                return attempt();
+            }
+        } else {
+            ec.wait(key);
+        }
+    }
+}
+
+}
+}
+} // namespace
+
+#endif	/* STATICLIB_CONTAINERS_DETAIL_EVENTCOUNT_HPP */
@@ -0,0 +1,216 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   ring_memory.hpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#ifndef STATICLIB_CONTAINERS_DETAIL_RING_MEMORY_HPP
+#define	STATICLIB_CONTAINERS_DETAIL_RING_MEMORY_HPP
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#else // !_WIN32
+#include <unistd.h>
+#endif // _WIN32
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif // __linux__
+
+#include "staticlib/containers/ring_allocation.hpp"
+
+namespace staticlib {
+namespace containers {
+namespace detail {
+
+/**
+ * Raw memory block for the ring storage allocated according to
+ * "ring_allocation" options, memory is anonymous "mmap" on Linux
+ * when huge pages or NUMA placement are requested and aligned
+ * heap allocation otherwise
+ */
+class ring_memory {
+    void* ptr;
+    size_t size;
+    bool mapped;
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other instance
+     */
+    ring_memory(const ring_memory&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other instance
+     * @return reference to self
+     */
+    ring_memory& operator=(const ring_memory&) = delete;
+
+    static size_t page_size() {
+#ifdef _WIN32
+        return 4096;
+#else // !_WIN32
+        long res = ::sysconf(_SC_PAGESIZE);
+        return res > 0 ? static_cast<size_t>(res) : 4096;
+#endif // _WIN32
+    }
+
+    static size_t round_up(size_t value, size_t alignment) {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+#ifdef __linux__
+    bool map(const ring_allocation& opts) {
+        const size_t huge_page_size = 2 * 1024 * 1024;
+        void* res = MAP_FAILED;
+        if (opts.huge_pages) {
+#ifdef MAP_HUGETLB
+            size_t huge_size = round_up(size, huge_page_size);
+            res = ::mmap(nullptr, huge_size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (MAP_FAILED != res) {
+                size = huge_size;
+            }
+#endif // MAP_HUGETLB
+        }
+        if (MAP_FAILED == res) {
+            size = round_up(size, opts.huge_pages ? huge_page_size : page_size());
+            res = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (MAP_FAILED == res) {
+                return false;
+            }
+#ifdef MADV_HUGEPAGE
+            if (opts.huge_pages) {
+                ::madvise(res, size, MADV_HUGEPAGE);
+            }
+#endif // MADV_HUGEPAGE
+        }
+#ifdef SYS_mbind
+        if (opts.numa_node >= 0 && opts.numa_node < static_cast<int>(sizeof(unsigned long) * 8)) {
+            // MPOL_PREFERRED, placement is a hint, libnuma is not required
+            const int mpol_preferred = 1;
+            unsigned long nodemask = 1UL << opts.numa_node;
+            ::syscall(SYS_mbind, res, size, mpol_preferred, &nodemask, sizeof(nodemask) * 8, 0);
+        }
+#endif // SYS_mbind
+        ptr = res;
+        mapped = true;
+        return true;
+    }
+#endif // __linux__
+
+    bool allocate_aligned(size_t alignment) {
+        if (alignment < sizeof(void*)) {
+            alignment = sizeof(void*);
+        }
+#ifdef _WIN32
+        ptr = ::_aligned_malloc(size, alignment);
+        return nullptr != ptr;
+#else // !_WIN32
+        return 0 == ::posix_memalign(&ptr, alignment, size);
+#endif // _WIN32
+    }
+
+    void prefault() {
+        volatile char* bytes = static_cast<volatile char*>(ptr);
+        size_t step = page_size();
+        for (size_t i = 0; i < size; i += step) {
+            bytes[i] = 0;
+        }
+    }
+
+public:
+    /**
+     * Constructor
+     *
+     * @param bytes number of bytes to allocate
+     * @param opts allocation options
+     * @throws std::bad_alloc if memory cannot be allocated
+     */
+    ring_memory(size_t bytes, const ring_allocation& opts) :
+    ptr(nullptr),
+    size(bytes > 0 ? bytes : 1),
+    mapped(false) {
+        bool success = false;
+#ifdef __linux__
+        if (opts.huge_pages || opts.numa_node >= 0) {
+            success = map(opts);
+        }
+#endif // __linux__
+        if (!success) {
+            success = allocate_aligned(opts.alignment);
+        }
+        if (!success) {
+            throw std::bad_alloc();
+        }
+        if (opts.prefault) {
+            prefault();
+        }
+    }
+
+    /**
+     * Destructor, frees the memory
+     */
+    ~ring_memory() {
+#ifdef __linux__
+        if (mapped) {
+            ::munmap(ptr, size);
+            return;
+        }
+#endif // __linux__
+#ifdef _WIN32
+        ::_aligned_free(ptr);
+#else // !_WIN32
+        std::free(ptr);
+#endif // _WIN32
+    }
+
+    /**
+     * Accessor for the allocated memory
+     *
+     * @return pointer to the memory
+     */
+    void* get() const {
+        return ptr;
+    }
+
+    /**
+     * Returns whether memory was mapped with "mmap"
+     *
+     * @return whether memory was mapped
+     */
+    bool is_mapped() const {
+        return mapped;
+    }
+};
+
+}
+}
+} // namespace
+
+#endif	/* STATICLIB_CONTAINERS_DETAIL_RING_MEMORY_HPP */
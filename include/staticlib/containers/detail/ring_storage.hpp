@@ -0,0 +1,184 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   ring_storage.hpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#ifndef STATICLIB_CONTAINERS_DETAIL_RING_STORAGE_HPP
+#define	STATICLIB_CONTAINERS_DETAIL_RING_STORAGE_HPP
+
+#include <cstdint>
+#include <type_traits>
+
+#include "staticlib/containers/ring_allocation.hpp"
+#include "staticlib/containers/detail/ring_memory.hpp"
+
+namespace staticlib {
+namespace containers {
+namespace detail {
+
+/**
+ * Rounds specified size up to the power of two
+ *
+ * @param size size to round
+ * @param res intermediate result
+ * @return power of two that is not less than size
+ */
+constexpr uint64_t ring_round_up_pow2(uint64_t size, uint64_t res = 1) {
+    return res >= size ? res : ring_round_up_pow2(size, res << 1);
+}
+
+/**
+ * Uninitialized slots for the ring queues, slots count is the capacity
+ * rounded up to the power of two, so slots can be addressed with a mask.
+ * This specialization stores the slots inline with the capacity
+ * specified at compile time.
+ */
+template<typename T, uint32_t Capacity>
+class ring_storage {
+    static_assert(Capacity > 0, "ring capacity must be positive");
+
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type
+    slots[ring_round_up_pow2(Capacity)];
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other instance
+     */
+    ring_storage(const ring_storage&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other instance
+     * @return reference to self
+     */
+    ring_storage& operator=(const ring_storage&) = delete;
+
+public:
+    /**
+     * Constructor
+     */
+    ring_storage() { }
+
+    /**
+     * Max number of elements in the ring
+     *
+     * @return capacity
+     */
+    static constexpr uint64_t capacity() {
+        return Capacity;
+    }
+
+    /**
+     * Mask to apply to the free-running index
+     *
+     * @return mask
+     */
+    static constexpr uint64_t mask() {
+        return ring_round_up_pow2(Capacity) - 1;
+    }
+
+    /**
+     * Accessor for the slot with the specified free-running index
+     *
+     * @param index free-running index
+     * @return pointer to uninitialized or constructed slot
+     */
+    T* slot(uint64_t index) {
+        return reinterpret_cast<T*>(&slots[index & mask()]);
+    }
+};
+
+/**
+ * Specialization for the capacity specified at runtime,
+ * slots are allocated on heap
+ */
+template<typename T>
+class ring_storage<T, 0> {
+    const uint64_t capacity_;
+    const uint64_t mask_;
+    ring_memory memory;
+    T * const slots;
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other instance
+     */
+    ring_storage(const ring_storage&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other instance
+     * @return reference to self
+     */
+    ring_storage& operator=(const ring_storage&) = delete;
+
+public:
+    /**
+     * Constructor
+     *
+     * @param size max number of elements in the ring
+     * @param allocation options for the allocation of the slots
+     * @throws std::bad_alloc if slots cannot be allocated
+     */
+    explicit ring_storage(uint32_t size, const ring_allocation& allocation = ring_allocation()) :
+    capacity_(size),
+    mask_(ring_round_up_pow2(size) - 1),
+    memory(sizeof(T) * (mask_ + 1), allocation),
+    slots(static_cast<T*>(memory.get())) { }
+
+    /**
+     * Max number of elements in the ring
+     *
+     * @return capacity
+     */
+    uint64_t capacity() const {
+        return capacity_;
+    }
+
+    /**
+     * Mask to apply to the free-running index
+     *
+     * @return mask
+     */
+    uint64_t mask() const {
+        return mask_;
+    }
+
+    /**
+     * Accessor for the slot with the specified free-running index
+     *
+     * @param index free-running index
+     * @return pointer to uninitialized or constructed slot
+     */
+    T* slot(uint64_t index) {
+        return &slots[index & mask_];
+    }
+};
+
+}
+}
+} // namespace
+
+#endif	/* STATICLIB_CONTAINERS_DETAIL_RING_STORAGE_HPP */
@@ -0,0 +1,347 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   mpmc_queue.hpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#ifndef STATICLIB_CONTAINERS_MPMC_QUEUE_HPP
+#define	STATICLIB_CONTAINERS_MPMC_QUEUE_HPP
+
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "staticlib/containers/detail/cache_line.hpp"
+
+namespace staticlib {
+namespace containers {
+
+/**
+ * Bounded FIFO queue without locks, supports multiple producers and
+ * multiple consumers. Each slot of the ring carries a sequence number
+ * that tells producers and consumers whether the slot is ready for them,
+ * see: http://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+ * All methods return immediately, see "blocking_mpmc_queue" for waiting support.
+ */
+template<typename T>
+class mpmc_queue {
+    struct cell {
+        std::atomic<size_t> sequence;
+        bool constructed;
+        typename std::aligned_storage<sizeof(T), std::alignment_of<T>::value>::type storage;
+    };
+
+    const size_t mask;
+    std::unique_ptr<cell[]> cells;
+
+    char pad0[detail::cache_line_size];
+    std::atomic<size_t> enqueue_pos;
+    char pad1[detail::cache_line_size];
+    std::atomic<size_t> dequeue_pos;
+    char pad2[detail::cache_line_size];
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    mpmc_queue(const mpmc_queue&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return reference to self
+     */
+    mpmc_queue& operator=(const mpmc_queue&) = delete;
+
+    static size_t round_up_pow2(size_t size) {
+        size_t res = 2;
+        while (res < size) {
+            res <<= 1;
+        }
+        return res;
+    }
+
+    cell* acquire_enqueue_cell(size_t& pos) {
+        pos = enqueue_pos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell* ce = &cells[pos & mask];
+            size_t seq = ce->sequence.load(std::memory_order_acquire);
+            intptr_t dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (0 == dif) {
+                if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    return ce;
+                }
+            } else if (dif < 0) {
+                // queue is full
+                return nullptr;
+            } else {
+                pos = enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    cell* acquire_dequeue_cell(size_t& pos) {
+        pos = dequeue_pos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell* ce = &cells[pos & mask];
+            size_t seq = ce->sequence.load(std::memory_order_acquire);
+            intptr_t dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (0 == dif) {
+                if (dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    return ce;
+                }
+            } else if (dif < 0) {
+                // queue is empty
+                return nullptr;
+            } else {
+                pos = dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * Destroys the element and releases the cell to producers on scope exit,
+     * so the cell is not lost when the element move throws
+     */
+    class consumed_cell {
+        cell* ce;
+        size_t next_sequence;
+
+    public:
+        consumed_cell(cell* ce, size_t next_sequence) :
+        ce(ce),
+        next_sequence(next_sequence) { }
+
+        ~consumed_cell() {
+            get().~T();
+            ce->sequence.store(next_sequence, std::memory_order_release);
+        }
+
+        T& get() {
+            return *reinterpret_cast<T*> (&ce->storage);
+        }
+    };
+
+    T move_out(cell* ce, size_t pos) {
+        consumed_cell consumed{ce, pos + mask + 1};
+        return std::move(consumed.get());
+    }
+
+    // returns false if the cell was released by the producer
+    // without an element due to the failed element constructor
+    bool dequeue_cell(cell*& ce, size_t& pos) {
+        for (;;) {
+            ce = acquire_dequeue_cell(pos);
+            if (nullptr == ce) {
+                return false;
+            }
+            if (ce->constructed) {
+                return true;
+            }
+            ce->sequence.store(pos + mask + 1, std::memory_order_release);
+        }
+    }
+
+public:
+    /**
+     * Type of elements
+     */
+    typedef T value_type;
+
+    /**
+     * Constructor, queue size is rounded up to the power of two
+     * 
+     * @param size queue size, must be >= 1
+     */
+    explicit mpmc_queue(size_t size) :
+    mask(round_up_pow2(size) - 1),
+    cells(new cell[mask + 1]),
+    enqueue_pos(0),
+    dequeue_pos(0) {
+        for (size_t i = 0; i <= mask; i++) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Destructor
+     */
+    ~mpmc_queue() {
+        size_t pos = 0;
+        cell* ce = nullptr;
+        while (dequeue_cell(ce, pos)) {
+            reinterpret_cast<T*> (&ce->storage)->~T();
+        }
+    }
+
+    /**
+     * Emplace a value at the end of the queue
+     * 
+     * @param recordArgs constructor arguments for queue element
+     * @return false if the queue was full, true otherwise
+     */
+    template<typename ...Args>
+    bool emplace(Args&&... record_args) {
+        size_t pos = 0;
+        cell* ce = acquire_enqueue_cell(pos);
+        if (nullptr == ce) {
+            return false;
+        }
+        try {
+            new (&ce->storage) T(std::forward<Args>(record_args)...);
+        } catch (...) {
+            // claimed cell cannot be given back, it is released empty
+            ce->constructed = false;
+            ce->sequence.store(pos + 1, std::memory_order_release);
+            throw;
+        }
+        ce->constructed = true;
+        ce->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Emplace the values from specified range into
+     * this queue
+     * 
+     * @param range source range
+     * @return number of elements emplaced
+     */
+    template<typename Range,
+            class = typename std::enable_if<!std::is_lvalue_reference<Range>::value>::type>
+    size_t emplace_range(Range&& range) {
+        size_t count = 0;
+        for (auto&& el : range) {
+            if (!emplace(std::move(el))) {
+                break;
+            }
+            count += 1;
+        }
+        return count;
+    }
+
+    /**
+     * Emplace the values from specified range into
+     * this queue
+     * 
+     * @param range source range
+     * @return number of elements emplaced
+     */
+    template<typename Range>
+    size_t emplace_range(Range& range) {
+        size_t count = 0;
+        for (auto& el : range) {
+            if (!emplace(el)) {
+                break;
+            }
+            count += 1;
+        }
+        return count;
+    }
+
+    /**
+     * Attempt to read the value at the front to the queue into a variable.
+     * 
+     * @param record move (or copy) the value at the front of the queue to given variable
+     * @return returns false if queue was empty, true otherwise
+     */
+    bool poll(T& record) {
+        size_t pos = 0;
+        cell* ce = nullptr;
+        if (!dequeue_cell(ce, pos)) {
+            return false;
+        }
+        consumed_cell consumed{ce, pos + mask + 1};
+        record = std::move(consumed.get());
+        return true;
+    }
+
+    /**
+     * Consume the contents of this queue into specified functor
+     * until the queue is found to be empty
+     * 
+     * @param func functor to consume contents
+     * @return number of elements consumed
+     */
+    template<typename Func>
+    size_t consume(Func func) {
+        size_t count = 0;
+        size_t pos = 0;
+        cell* ce = nullptr;
+        while (dequeue_cell(ce, pos)) {
+            T record = move_out(ce, pos);
+            func(std::move(record));
+            count += 1;
+        }
+        return count;
+    }
+
+    /**
+     * Check if the queue is empty, result may be outdated
+     * when other threads access the queue concurrently
+     * 
+     * @return whether queue is empty
+     */
+    bool is_empty() const {
+        return 0 == size();
+    }
+
+    /**
+     * Check if the queue is full, result may be outdated
+     * when other threads access the queue concurrently
+     * 
+     * @return whether queue is full
+     */
+    bool is_full() const {
+        return size() >= max_size();
+    }
+
+    /**
+     * Returns the number of entries in the queue, result may be outdated
+     * when other threads access the queue concurrently
+     * 
+     * @return number of entries in the queue
+     */
+    size_t size() const {
+        size_t deq = dequeue_pos.load(std::memory_order_acquire);
+        size_t enq = enqueue_pos.load(std::memory_order_acquire);
+        return enq > deq ? enq - deq : 0;
+    }
+
+    /**
+     * Accessor for max queue size, it is the size specified
+     * at creation rounded up to the power of two
+     * 
+     * @return max queue size
+     */
+    size_t max_size() const {
+        return mask + 1;
+    }
+};
+
+}
+} // namespace
+
+#endif	/* STATICLIB_CONTAINERS_MPMC_QUEUE_HPP */
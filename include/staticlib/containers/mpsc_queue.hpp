@@ -0,0 +1,374 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   mpsc_queue.hpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#ifndef STATICLIB_CONTAINERS_MPSC_QUEUE_HPP
+#define	STATICLIB_CONTAINERS_MPSC_QUEUE_HPP
+
+#include <cstddef>
+#include <atomic>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "staticlib/containers/mpmc_queue.hpp"
+#include "staticlib/containers/detail/cache_line.hpp"
+#include "staticlib/containers/detail/eventcount.hpp"
+
+namespace staticlib {
+namespace containers {
+
+template<typename T>
+class intrusive_mpsc_queue;
+
+/**
+ * Link hook for the elements of "intrusive_mpsc_queue",
+ * element types must publicly inherit it
+ */
+class mpsc_hook {
+    template<typename T>
+    friend class intrusive_mpsc_queue;
+
+    std::atomic<mpsc_hook*> mpsc_next;
+
+public:
+    /**
+     * Constructor
+     */
+    mpsc_hook() :
+    mpsc_next(nullptr) { }
+
+    /**
+     * Copy constructor, link is not copied
+     *
+     * @param other instance
+     */
+    mpsc_hook(const mpsc_hook&) :
+    mpsc_next(nullptr) { }
+
+    /**
+     * Copy assignment operator, link is not copied
+     *
+     * @param other instance
+     * @return reference to self
+     */
+    mpsc_hook& operator=(const mpsc_hook&) {
+        return *this;
+    }
+};
+
+/**
+ * Multiple producers single consumer unbounded queue of the elements
+ * that inherit "mpsc_hook", queue does not allocate and does not own
+ * the elements. Producers push elements onto a shared stack with a single
+ * atomic exchange (wait-free), consumer takes the whole stack with another
+ * exchange and reverses it into a private FIFO list. Consumer may briefly
+ * spin on the element of the producer that was preempted between
+ * its exchange and its link store.
+ */
+template<typename T>
+class intrusive_mpsc_queue {
+    static_assert(std::is_base_of<mpsc_hook, T>::value,
+            "intrusive queue elements must inherit mpsc_hook");
+
+    // producers side
+    char pad0[detail::cache_line_size];
+    std::atomic<mpsc_hook*> head;
+
+    // consumer side
+    char pad1[detail::cache_line_size];
+    mpsc_hook* cache;
+    // marks the link that is not yet stored by producer
+    mpsc_hook pending;
+
+    char pad2[detail::cache_line_size];
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other instance
+     */
+    intrusive_mpsc_queue(const intrusive_mpsc_queue&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other instance
+     * @return reference to self
+     */
+    intrusive_mpsc_queue& operator=(const intrusive_mpsc_queue&) = delete;
+
+    mpsc_hook* load_next(mpsc_hook* node) {
+        mpsc_hook* next = node->mpsc_next.load(std::memory_order_acquire);
+        while (&pending == next) {
+            detail::cpu_relax();
+            next = node->mpsc_next.load(std::memory_order_acquire);
+        }
+        return next;
+    }
+
+    mpsc_hook* grab_all() {
+        mpsc_hook* node = head.exchange(nullptr, std::memory_order_acquire);
+        mpsc_hook* reversed = nullptr;
+        while (nullptr != node) {
+            mpsc_hook* next = load_next(node);
+            node->mpsc_next.store(reversed, std::memory_order_relaxed);
+            reversed = node;
+            node = next;
+        }
+        return reversed;
+    }
+
+public:
+    /**
+     * Type of elements
+     */
+    typedef T value_type;
+
+    /**
+     * Constructor
+     */
+    intrusive_mpsc_queue() :
+    head(nullptr),
+    cache(nullptr) { }
+
+    /**
+     * Add an element at the end of the queue, can be called by any thread,
+     * element must not be in the queue already and must not be destroyed
+     * until it is popped
+     *
+     * @param record element to add
+     */
+    void push(T* record) {
+        mpsc_hook* node = record;
+        node->mpsc_next.store(&pending, std::memory_order_relaxed);
+        mpsc_hook* prev = head.exchange(node, std::memory_order_acq_rel);
+        node->mpsc_next.store(prev, std::memory_order_release);
+    }
+
+    /**
+     * Take the element from the front of the queue, can be called only by consumer
+     *
+     * @return element, nullptr if the queue was empty
+     */
+    T* pop() {
+        if (nullptr == cache) {
+            cache = grab_all();
+            if (nullptr == cache) {
+                return nullptr;
+            }
+        }
+        mpsc_hook* node = cache;
+        cache = node->mpsc_next.load(std::memory_order_relaxed);
+        return static_cast<T*>(node);
+    }
+
+    /**
+     * Pass all the elements currently available in this queue to the specified
+     * functor, all pending elements are taken with a single atomic exchange.
+     * Can be called only by consumer, functor may push the element back.
+     *
+     * @param func functor accepting pointer to the element
+     * @return number of elements consumed
+     */
+    template<typename Func>
+    size_t consume(Func func) {
+        if (nullptr == cache) {
+            cache = grab_all();
+        }
+        size_t count = 0;
+        while (nullptr != cache) {
+            mpsc_hook* node = cache;
+            cache = node->mpsc_next.load(std::memory_order_relaxed);
+            func(static_cast<T*>(node));
+            count += 1;
+        }
+        return count;
+    }
+
+    /**
+     * Check if the queue is empty, can be called only by consumer
+     *
+     * @return whether queue is empty
+     */
+    bool is_empty() const {
+        return nullptr == cache && nullptr == head.load(std::memory_order_acquire);
+    }
+};
+
+/**
+ * Multiple producers single consumer unbounded queue, elements are kept
+ * in the nodes of "intrusive_mpsc_queue". Nodes are taken from a pool
+ * that is allocated on creation ("mpmc_queue" is used as a lock-free free list),
+ * when the pool is exhausted, nodes are allocated on heap and are freed
+ * when consumed.
+ */
+template<typename T>
+class mpsc_queue {
+    struct node : mpsc_hook {
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+
+        T* value() {
+            return reinterpret_cast<T*>(&storage);
+        }
+    };
+
+    intrusive_mpsc_queue<node> queue;
+    std::unique_ptr<node[]> pool_nodes;
+    const size_t pool_size;
+    mpmc_queue<node*> pool;
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other instance
+     */
+    mpsc_queue(const mpsc_queue&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other instance
+     * @return reference to self
+     */
+    mpsc_queue& operator=(const mpsc_queue&) = delete;
+
+    node* acquire_node() {
+        node* res = nullptr;
+        if (pool.poll(res)) {
+            return res;
+        }
+        return new node();
+    }
+
+    void release_node(node* nd) {
+        if (nd >= pool_nodes.get() && nd < pool_nodes.get() + pool_size) {
+            // pool capacity is not less than the number of pool nodes
+            pool.emplace(nd);
+        } else {
+            delete nd;
+        }
+    }
+
+public:
+    /**
+     * Type of elements
+     */
+    typedef T value_type;
+
+    /**
+     * Constructor
+     *
+     * @param pool_size number of nodes to pre-allocate
+     */
+    explicit mpsc_queue(size_t pool_size = 1024) :
+    pool_nodes(new node[pool_size > 0 ? pool_size : 1]),
+    pool_size(pool_size > 0 ? pool_size : 1),
+    pool(this->pool_size) {
+        for (size_t i = 0; i < this->pool_size; i++) {
+            pool.emplace(&pool_nodes[i]);
+        }
+    }
+
+    /**
+     * Destructor, destroys the elements left in the queue
+     */
+    ~mpsc_queue() {
+        queue.consume([this](node* nd) {
+            nd->value()->~T();
+            this->release_node(nd);
+        });
+    }
+
+    /**
+     * Emplace a value at the end of the queue, can be called by any thread
+     *
+     * @param recordArgs constructor arguments for queue element
+     */
+    template<typename ...Args>
+    void emplace(Args&&... record_args) {
+        node* nd = acquire_node();
+        try {
+            new (nd->value()) T(std::forward<Args>(record_args)...);
+        } catch (...) {
+            release_node(nd);
+            throw;
+        }
+        queue.push(nd);
+    }
+
+    /**
+     * Attempt to read the value at the front to the queue into a variable,
+     * can be called only by consumer
+     *
+     * @param record move (or copy) the value at the front of the queue to given variable
+     * @return false if queue was empty, true otherwise
+     */
+    bool poll(T& record) {
+        node* nd = queue.pop();
+        if (nullptr == nd) {
+            return false;
+        }
+        record = std::move(*nd->value());
+        nd->value()->~T();
+        release_node(nd);
+        return true;
+    }
+
+    /**
+     * Consume all the values currently available in this queue into
+     * specified functor, all pending values are taken with a single
+     * atomic exchange. Can be called only by consumer.
+     *
+     * @param func functor to consume contents
+     * @return number of elements consumed
+     */
+    template<typename Func>
+    size_t consume(Func func) {
+        return queue.consume([this, &func](node* nd) {
+            try {
+                func(std::move(*nd->value()));
+            } catch (...) {
+                nd->value()->~T();
+                this->release_node(nd);
+                throw;
+            }
+            nd->value()->~T();
+            this->release_node(nd);
+        });
+    }
+
+    /**
+     * Check if the queue is empty, can be called only by consumer
+     *
+     * @return whether queue is empty
+     */
+    bool is_empty() const {
+        return queue.is_empty();
+    }
+};
+
+}
+} // namespace
+
+#endif	/* STATICLIB_CONTAINERS_MPSC_QUEUE_HPP */
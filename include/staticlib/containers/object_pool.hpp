@@ -0,0 +1,295 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   object_pool.hpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#ifndef STATICLIB_CONTAINERS_OBJECT_POOL_HPP
+#define	STATICLIB_CONTAINERS_OBJECT_POOL_HPP
+
+#include <cstddef>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "staticlib/containers/mpmc_queue.hpp"
+
+namespace staticlib {
+namespace containers {
+
+/**
+ * Pool of reusable default-constructed objects, intended to be used as
+ * a return path for the queue elements: producer acquires an object, fills it
+ * and passes "pooled_ptr" through the queue, when consumer drops the pointer
+ * the object is returned to the pool instead of being freed. Objects are
+ * returned as is, so their buffers (e.g. string capacity) are reused,
+ * user is responsible for clearing the contents. Returned objects are kept
+ * in the bounded lock-free free list ("mpmc_queue"), objects that do not fit
+ * into it are deleted. Per-thread "local_cache" can be used to exchange
+ * objects with the free list in batches. All acquired objects must be
+ * returned before the pool is destroyed.
+ */
+template<typename T>
+class object_pool {
+public:
+    /**
+     * Deleter for "pooled_ptr" that returns the object to the pool
+     */
+    class releaser {
+        object_pool* pool;
+
+    public:
+        /**
+         * Constructor
+         *
+         * @param pool pool to return objects to
+         */
+        explicit releaser(object_pool* pool = nullptr) :
+        pool(pool) { }
+
+        /**
+         * Returns the object to the pool
+         *
+         * @param obj pooled object
+         */
+        void operator()(T* obj) const {
+            pool->release(obj);
+        }
+    };
+
+    /**
+     * Owning pointer to the pooled object, can be moved through the queues
+     */
+    typedef std::unique_ptr<T, releaser> pooled_ptr;
+
+    /**
+     * Cache of the pooled objects owned by a single thread, exchanges objects
+     * with the shared free list in batches, remaining objects are returned
+     * to the free list on destruction
+     */
+    class local_cache {
+        object_pool& pool;
+        const size_t batch_size;
+        std::vector<T*> cached;
+
+        /**
+         * Deleted copy constructor
+         *
+         * @param other instance
+         */
+        local_cache(const local_cache&) = delete;
+
+        /**
+         * Deleted copy assignment operator
+         *
+         * @param other instance
+         * @return reference to self
+         */
+        local_cache& operator=(const local_cache&) = delete;
+
+        void flush(size_t count) {
+            for (size_t i = 0; i < count && !cached.empty(); i++) {
+                pool.release(cached.back());
+                cached.pop_back();
+            }
+        }
+
+    public:
+        /**
+         * Constructor
+         *
+         * @param pool shared pool
+         * @param batch_size number of objects to take from (or return to)
+         *        the shared free list at once
+         */
+        explicit local_cache(object_pool& pool, size_t batch_size = 32) :
+        pool(pool),
+        batch_size(batch_size > 0 ? batch_size : 1) {
+            cached.reserve(this->batch_size * 2);
+        }
+
+        /**
+         * Destructor, returns cached objects to the shared pool
+         */
+        ~local_cache() {
+            flush(cached.size());
+        }
+
+        /**
+         * Take an object from this cache, refills the cache from the shared
+         * free list when it is empty, allocates new object when the pool is empty
+         *
+         * @return pooled object that is returned to the shared pool on destruction
+         */
+        pooled_ptr acquire() {
+            if (cached.empty()) {
+                T* obj = nullptr;
+                while (cached.size() < batch_size && pool.free_list.poll(obj)) {
+                    cached.push_back(obj);
+                }
+                if (cached.empty()) {
+                    return pooled_ptr(pool.allocate(), releaser(&pool));
+                }
+            }
+            T* res = cached.back();
+            cached.pop_back();
+            return pooled_ptr(res, releaser(&pool));
+        }
+
+        /**
+         * Return an object to this cache, can be used instead of dropping
+         * the pointer when the object is released on the same thread,
+         * excess objects are moved to the shared free list
+         *
+         * @param ptr pooled object
+         */
+        void release(pooled_ptr&& ptr) {
+            if (nullptr == ptr.get()) {
+                return;
+            }
+            cached.push_back(ptr.release());
+            if (cached.size() >= batch_size * 2) {
+                flush(batch_size);
+            }
+        }
+
+        /**
+         * Returns the number of objects in this cache
+         *
+         * @return number of cached objects
+         */
+        size_t size() const {
+            return cached.size();
+        }
+    };
+
+private:
+    mpmc_queue<T*> free_list;
+    std::atomic<size_t> allocations;
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other instance
+     */
+    object_pool(const object_pool&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other instance
+     * @return reference to self
+     */
+    object_pool& operator=(const object_pool&) = delete;
+
+    T* allocate() {
+        T* res = new T();
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        return res;
+    }
+
+public:
+    /**
+     * Type of elements
+     */
+    typedef T value_type;
+
+    /**
+     * Constructor
+     *
+     * @param max_pooled max number of the returned objects kept in the free list,
+     *        rounded up to the power of two
+     * @param preallocated number of objects to allocate on creation
+     */
+    explicit object_pool(size_t max_pooled = 1024, size_t preallocated = 0) :
+    free_list(max_pooled > 0 ? max_pooled : 1),
+    allocations(0) {
+        for (size_t i = 0; i < preallocated; i++) {
+            std::unique_ptr<T> obj{allocate()};
+            if (!free_list.emplace(obj.get())) {
+                break;
+            }
+            obj.release();
+        }
+    }
+
+    /**
+     * Destructor, deletes the objects kept in the free list
+     */
+    ~object_pool() {
+        T* obj = nullptr;
+        while (free_list.poll(obj)) {
+            delete obj;
+        }
+    }
+
+    /**
+     * Take an object from the free list, allocates new object
+     * when the pool is empty, can be called by any thread
+     *
+     * @return pooled object that is returned to the pool on destruction
+     */
+    pooled_ptr acquire() {
+        T* obj = nullptr;
+        if (!free_list.poll(obj)) {
+            obj = allocate();
+        }
+        return pooled_ptr(obj, releaser(this));
+    }
+
+    /**
+     * Return an object to the free list, object is deleted if the free list
+     * is full, can be called by any thread
+     *
+     * @param obj object acquired from this pool
+     */
+    void release(T* obj) {
+        if (nullptr == obj) {
+            return;
+        }
+        if (!free_list.emplace(obj)) {
+            delete obj;
+        }
+    }
+
+    /**
+     * Returns approximate number of objects in the free list
+     *
+     * @return number of pooled objects
+     */
+    size_t size_guess() const {
+        return free_list.size();
+    }
+
+    /**
+     * Returns the number of objects allocated by this pool since creation,
+     * does not change in steady state when all objects are reused
+     *
+     * @return number of allocations
+     */
+    size_t allocations_count() const {
+        return allocations.load(std::memory_order_relaxed);
+    }
+};
+
+}
+} // namespace
+
+#endif	/* STATICLIB_CONTAINERS_OBJECT_POOL_HPP */
@@ -39,6 +39,8 @@
 #define STATICLIB_CONTAINERS_PRODUCER_CONSUMER_QUEUE_HPP
 
 #include <cstdlib>
+#include <cstring>
+#include <algorithm>
 #include <atomic>
 #include <memory>
 #include <new>
@@ -46,6 +48,11 @@
 #include <type_traits>
 #include <utility>
 
+#include "staticlib/containers/detail/cache_line.hpp"
+#include "staticlib/containers/detail/ring_storage.hpp"
+#include "staticlib/containers/queue_stats.hpp"
+#include "staticlib/containers/ring_allocation.hpp"
+
 namespace staticlib {
 namespace containers {
 
@@ -53,16 +60,38 @@ namespace containers {
  * ProducerConsumerQueue is a one producer and one consumer queue
  * without locks. 
  * See docs: https://github.com/facebook/folly/blob/master/folly/docs/ProducerConsumerQueue.md
- * Note, 'popFront' method was removed as it didn't work properly with MSVC.
+ * Elements can be produced and consumed in place with "reserve"/"commit"
+ * and "front_ptr"/"pop_front" pairs, original 'popFront' method was
+ * reimplemented as "pop_front" using cached write index.
+ * Read and write indices are placed on separate cache lines, each side
+ * keeps a private copy of the other side's index and reloads it
+ * only when the queue looks full (producer) or empty (consumer).
+ * Indices are free-running 64-bit counters, slots are addressed with a mask
+ * over power-of-two sized storage, so no sentinel slot and no wrap-around
+ * branches are needed.
+ * Optional counters can be enabled with "queue_stats" policy.
+ * When non-zero "Capacity" is specified, records are stored inline
+ * (see "static_producer_consumer_queue"), otherwise they are allocated
+ * on heap with the size specified at runtime.
  */
-template<typename T>
+template<typename T, typename Stats = no_queue_stats, uint32_t Capacity = 0>
 class producer_consumer_queue {        
-    const uint32_t size_;
-    T * const records_;
+    detail::ring_storage<T, Capacity> records_;
+
+    // consumer side
+    char pad0_[detail::cache_line_size];
+    std::atomic<uint64_t> readIndex_;
+    uint64_t writeIndexCache_;
+
+    // producer side
+    char pad1_[detail::cache_line_size];
+    std::atomic<uint64_t> writeIndex_;
+    uint64_t readIndexCache_;
+
+    char pad2_[detail::cache_line_size];
+
+    Stats stats_;
 
-    std::atomic<unsigned int> readIndex_;
-    std::atomic<unsigned int> writeIndex_;
-    
     /**
      * Deleted copy constructor
      * 
@@ -78,6 +107,191 @@ class producer_consumer_queue {
      */
     producer_consumer_queue& operator=(const producer_consumer_queue&) = delete;
 
+    T* slot(uint64_t index) {
+        return records_.slot(index);
+    }
+
+    // called by producer
+    bool has_space(uint64_t currentWrite) {
+        if (currentWrite - readIndexCache_ == records_.capacity()) {
+            readIndexCache_ = readIndex_.load(std::memory_order_acquire);
+            if (currentWrite - readIndexCache_ == records_.capacity()) {
+                // queue is full
+                stats_.on_reject();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // called by consumer
+    bool has_records(uint64_t currentRead) {
+        if (currentRead == writeIndexCache_) {
+            writeIndexCache_ = writeIndex_.load(std::memory_order_acquire);
+            if (currentRead == writeIndexCache_) {
+                // queue is empty
+                return false;
+            }
+        }
+        return true;
+    }
+
+    size_t size_after_write(uint64_t nextWrite) const {
+        return static_cast<size_t>(nextWrite - readIndex_.load(std::memory_order_relaxed));
+    }
+
+    template<typename E>
+    static E&& forward_element(E& el, std::true_type) {
+        return std::move(el);
+    }
+
+    template<typename E>
+    static E& forward_element(E& el, std::false_type) {
+        return el;
+    }
+
+    struct pointer_range {
+        const T* first;
+        const T* last;
+
+        const T* begin() const {
+            return first;
+        }
+
+        const T* end() const {
+            return last;
+        }
+    };
+
+    // slots for the free-running indices are contiguous up to the end of storage
+    template<typename Copy>
+    void for_each_span(uint64_t begin, size_t count, Copy copy) {
+        size_t offset = static_cast<size_t>(begin & records_.mask());
+        size_t first = (std::min)(count, static_cast<size_t>(records_.mask() + 1) - offset);
+        copy(slot(begin), 0, first);
+        if (first < count) {
+            copy(slot(begin + first), first, count - first);
+        }
+    }
+
+    size_t emplace_n_internal(const T* records, size_t count, std::true_type) {
+        auto const currentWrite = writeIndex_.load(std::memory_order_relaxed);
+        auto free_count = records_.capacity() - (currentWrite - readIndexCache_);
+        if (free_count < count) {
+            readIndexCache_ = readIndex_.load(std::memory_order_acquire);
+            free_count = records_.capacity() - (currentWrite - readIndexCache_);
+        }
+        size_t n = static_cast<size_t>((std::min)(static_cast<uint64_t>(count), free_count));
+        if (n < count) {
+            stats_.on_reject();
+        }
+        if (0 == n) {
+            return 0;
+        }
+        for_each_span(currentWrite, n, [records](T* dest, size_t from, size_t span) {
+            std::memcpy(static_cast<void*>(dest), records + from, span * sizeof(T));
+        });
+        auto const nextWrite = currentWrite + n;
+        writeIndex_.store(nextWrite, std::memory_order_release);
+        if (Stats::enabled) {
+            stats_.on_enqueue(n, size_after_write(nextWrite));
+        }
+        return n;
+    }
+
+    size_t emplace_n_internal(const T* records, size_t count, std::false_type) {
+        pointer_range range{records, records + count};
+        return emplace_range_internal(range, std::false_type());
+    }
+
+    size_t poll_n_internal(T* out, size_t max_count, std::true_type) {
+        auto const currentRead = readIndex_.load(std::memory_order_relaxed);
+        writeIndexCache_ = writeIndex_.load(std::memory_order_acquire);
+        size_t n = static_cast<size_t>((std::min)(static_cast<uint64_t>(max_count),
+                writeIndexCache_ - currentRead));
+        if (0 == n) {
+            return 0;
+        }
+        for_each_span(currentRead, n, [out](T* src, size_t from, size_t span) {
+            std::memcpy(static_cast<void*>(out + from), src, span * sizeof(T));
+        });
+        readIndex_.store(currentRead + n, std::memory_order_release);
+        stats_.on_dequeue(n);
+        return n;
+    }
+
+    size_t poll_n_internal(T* out, size_t max_count, std::false_type) {
+        auto func = [&out](T&& record) {
+            *out = std::move(record);
+            ++out;
+        };
+        return consume_internal(func, max_count);
+    }
+
+    void destroy_records(std::true_type) { }
+
+    void destroy_records(std::false_type) {
+        uint64_t read = readIndex_;
+        uint64_t end = writeIndex_;
+        while (read != end) {
+            slot(read)->~T();
+            read += 1;
+        }
+    }
+
+    template<typename Range, typename MoveTag>
+    size_t emplace_range_internal(Range& range, MoveTag tag) {
+        auto currentWrite = writeIndex_.load(std::memory_order_relaxed);
+        size_t count = 0;
+        try {
+            for (auto&& el : range) {
+                if (!has_space(currentWrite)) {
+                    break;
+                }
+                new (slot(currentWrite)) T(forward_element(el, tag));
+                currentWrite += 1;
+                count += 1;
+            }
+        } catch (...) {
+            // publish the records constructed before the failure
+            writeIndex_.store(currentWrite, std::memory_order_release);
+            throw;
+        }
+        if (count > 0) {
+            writeIndex_.store(currentWrite, std::memory_order_release);
+            if (Stats::enabled) {
+                stats_.on_enqueue(count, size_after_write(currentWrite));
+            }
+        }
+        return count;
+    }
+
+    template<typename Func>
+    size_t consume_internal(Func& func, size_t max_count) {
+        auto currentRead = readIndex_.load(std::memory_order_relaxed);
+        writeIndexCache_ = writeIndex_.load(std::memory_order_acquire);
+        size_t count = 0;
+        try {
+            while (count < max_count && currentRead != writeIndexCache_) {
+                T* record = slot(currentRead);
+                func(std::move(*record));
+                record->~T();
+                currentRead += 1;
+                count += 1;
+            }
+        } catch (...) {
+            // release the records consumed before the failure
+            readIndex_.store(currentRead, std::memory_order_release);
+            stats_.on_dequeue(count);
+            throw;
+        }
+        if (count > 0) {
+            readIndex_.store(currentRead, std::memory_order_release);
+            stats_.on_dequeue(count);
+        }
+        return count;
+    }
+
 public:
     /**
      * Type of elements
@@ -85,20 +299,29 @@ public:
     typedef T value_type;
     
     /**
-     * Constructor,
+     * Constructor, storage is allocated for the specified size rounded up
+     * to the power of two, queue holds at most "size" elements,
+     * can be used only with zero "Capacity"
      * 
      * @param size queue size, must be >= 1
+     * @param allocation options for the allocation of the storage
      */
-    explicit producer_consumer_queue(uint32_t size) : 
-    size_(size + 1), 
-    records_(static_cast<T*> (std::malloc(sizeof (T) * (size + 1)))), 
+    explicit producer_consumer_queue(uint32_t size, const ring_allocation& allocation = ring_allocation()) : 
+    records_(size, allocation), 
     readIndex_(0), 
-    writeIndex_(0) {
-//        assert(size >= 2);
-        if (!records_) {
-            throw std::bad_alloc();
-        }
-    }
+    writeIndexCache_(0),
+    writeIndex_(0),
+    readIndexCache_(0) { }
+
+    /**
+     * Constructor for the queue with inline storage,
+     * can be used only with non-zero "Capacity"
+     */
+    producer_consumer_queue() :
+    readIndex_(0), 
+    writeIndexCache_(0),
+    writeIndex_(0),
+    readIndexCache_(0) { }
 
     /**
      * Destructor
@@ -107,20 +330,7 @@ public:
         // We need to destruct anything that may still exist in our queue.
         // (No real synchronization needed at destructor time: only one
         // thread can be doing this.)
-        
-        // check disabled, still safe, may be slower
-//        if (!boost::has_trivial_destructor<T>::value) {
-            size_t read = readIndex_;
-            size_t end = writeIndex_;
-            while (read != end) {
-                records_[read].~T();
-                if (++read == size_) {
-                    read = 0;
-                }
-            }
-//        }
-
-        std::free(records_);
+        destroy_records(std::is_trivially_destructible<T>());
     }
 
     /**
@@ -132,18 +342,85 @@ public:
     template<class ...Args>
     bool emplace(Args&&... record_args) {
         auto const currentWrite = writeIndex_.load(std::memory_order_relaxed);
-        auto nextRecord = currentWrite + 1;
-        if (nextRecord == size_) {
-            nextRecord = 0;
+        if (!has_space(currentWrite)) {
+            return false;
         }
-        if (nextRecord != readIndex_.load(std::memory_order_acquire)) {
-            new (&records_[currentWrite]) T(std::forward<Args>(record_args)...);
-            writeIndex_.store(nextRecord, std::memory_order_release);
-            return true;
+        new (slot(currentWrite)) T(std::forward<Args>(record_args)...);
+        auto const nextRecord = currentWrite + 1;
+        writeIndex_.store(nextRecord, std::memory_order_release);
+        if (Stats::enabled) {
+            stats_.on_enqueue(1, size_after_write(nextRecord));
+        }
+        return true;
+    }
+
+    /**
+     * Retrieve a pointer to the uninitialized slot at the end of the queue,
+     * the element must be constructed in this slot (using placement new,
+     * or by writing into it for trivial types) before calling "commit".
+     * Repeated calls without "commit" return the same slot.
+     * 
+     * @return pointer to the slot, nullptr if the queue is full
+     */
+    T* reserve() {
+        auto const currentWrite = writeIndex_.load(std::memory_order_relaxed);
+        if (!has_space(currentWrite)) {
+            return nullptr;
         }
+        return slot(currentWrite);
+    }
 
-        // queue is full
-        return false;
+    /**
+     * Publish the element constructed in the slot returned by "reserve",
+     * must be called only after successful "reserve"
+     */
+    void commit() {
+        auto const nextRecord = writeIndex_.load(std::memory_order_relaxed) + 1;
+        writeIndex_.store(nextRecord, std::memory_order_release);
+        if (Stats::enabled) {
+            stats_.on_enqueue(1, size_after_write(nextRecord));
+        }
+    }
+
+    /**
+     * Emplace the values from specified range into this queue,
+     * write index is published once for the whole range
+     * 
+     * @param range source range
+     * @return number of elements emplaced, can be less than the
+     *         range size if the queue became full
+     */
+    template<typename Range,
+            class = typename std::enable_if<!std::is_lvalue_reference<Range>::value>::type>
+    size_t emplace_range(Range&& range) {
+        return emplace_range_internal(range, std::true_type());
+    }
+
+    /**
+     * Emplace the values from specified range into this queue,
+     * write index is published once for the whole range
+     * 
+     * @param range source range
+     * @return number of elements emplaced, can be less than the
+     *         range size if the queue became full
+     */
+    template<typename Range>
+    size_t emplace_range(Range& range) {
+        return emplace_range_internal(range, std::false_type());
+    }
+
+    /**
+     * Copy the specified number of values into this queue, write index
+     * is published once for the whole batch. Trivially-copyable values
+     * are copied with "memcpy" in at most two contiguous spans.
+     * 
+     * @param records pointer to the values to copy
+     * @param count number of values
+     * @return number of values copied, can be less than the
+     *         specified count if the queue became full
+     */
+    size_t emplace_n(const T* records, size_t count) {
+        return emplace_n_internal(records, count, std::is_trivially_copyable<T>());
     }
 
     /**
@@ -154,21 +431,60 @@ public:
      */
     bool poll(T& record) {
         auto const currentRead = readIndex_.load(std::memory_order_relaxed);
-        if (currentRead == writeIndex_.load(std::memory_order_acquire)) {
-            // queue is empty
+        if (!has_records(currentRead)) {
             return false;
         }
-
-        auto nextRecord = currentRead + 1;
-        if (nextRecord == size_) {
-            nextRecord = 0;
-        }
-        record = std::move(records_[currentRead]);
-        records_[currentRead].~T();
-        readIndex_.store(nextRecord, std::memory_order_release);
+        T* front = slot(currentRead);
+        record = std::move(*front);
+        front->~T();
+        readIndex_.store(currentRead + 1, std::memory_order_release);
+        stats_.on_dequeue(1);
         return true;
     }
 
+    /**
+     * Move up to the specified number of values from the front of the queue
+     * into the output iterator, read index is published once for the whole batch
+     * 
+     * @param out output iterator to move (or copy) the values into
+     * @param max_count max number of values to read
+     * @return number of values read, zero if queue was empty
+     */
+    template<typename OutputIterator>
+    size_t poll_n(OutputIterator out, size_t max_count) {
+        auto func = [&out](T&& record) {
+            *out = std::move(record);
+            ++out;
+        };
+        return consume_internal(func, max_count);
+    }
+
+    /**
+     * Move up to the specified number of values from the front of the queue
+     * into the contiguous array, read index is published once for the whole batch.
+     * Trivially-copyable values are copied with "memcpy" in at most
+     * two contiguous spans.
+     * 
+     * @param out array to move (or copy) the values into
+     * @param max_count max number of values to read
+     * @return number of values read, zero if queue was empty
+     */
+    size_t poll_n(T* out, size_t max_count) {
+        return poll_n_internal(out, max_count, std::is_trivially_copyable<T>());
+    }
+
+    /**
+     * Consume all the values currently available in this queue into
+     * specified functor, read index is published once for the whole batch
+     * 
+     * @param func functor to consume contents
+     * @return number of elements consumed
+     */
+    template<typename Func>
+    size_t consume(Func func) {
+        return consume_internal(func, static_cast<size_t>(-1));
+    }
+
     /**
      * Retrieve a pointer to the item at the front of the queue
      * 
@@ -176,11 +492,27 @@ public:
      */
     T* front_ptr() {
         auto const currentRead = readIndex_.load(std::memory_order_relaxed);
-        if (currentRead == writeIndex_.load(std::memory_order_acquire)) {
-            // queue is empty
+        if (!has_records(currentRead)) {
             return nullptr;
         }
-        return &records_[currentRead];
+        return slot(currentRead);
+    }
+
+    /**
+     * Destroy the item at the front of the queue in place, can be used
+     * after "front_ptr" to consume the item without moving it out
+     * 
+     * @return false if queue was empty, true otherwise
+     */
+    bool pop_front() {
+        auto const currentRead = readIndex_.load(std::memory_order_relaxed);
+        if (!has_records(currentRead)) {
+            return false;
+        }
+        slot(currentRead)->~T();
+        readIndex_.store(currentRead + 1, std::memory_order_release);
+        stats_.on_dequeue(1);
+        return true;
     }
 
     /**
@@ -199,15 +531,8 @@ public:
      * @return whether queue is full
      */
     bool is_full() const {
-        auto nextRecord = writeIndex_.load(std::memory_order_acquire) + 1;
-        if (nextRecord == size_) {
-            nextRecord = 0;
-        }
-        if (nextRecord != readIndex_.load(std::memory_order_acquire)) {
-            return false;
-        }
-        // queue is full
-        return true;
+        auto const read = readIndex_.load(std::memory_order_acquire);
+        return writeIndex_.load(std::memory_order_acquire) - read >= records_.capacity();
     }
 
     /**
@@ -217,16 +542,13 @@ public:
      * If called by producer, then true size may be less (because consumer may
      * be removing items concurrently).
      * It is undefined to call this from any other thread.
+     * Exact when there are no concurrent operations.
      * 
      * @return number of entries in the queue
      */
     size_t size_guess() const {
-        int ret = writeIndex_.load(std::memory_order_acquire) -
-                readIndex_.load(std::memory_order_acquire);
-        if (ret < 0) {
-            ret += size_;
-        }
-        return ret;
+        auto const read = readIndex_.load(std::memory_order_acquire);
+        return static_cast<size_t>(writeIndex_.load(std::memory_order_acquire) - read);
     }
     
     /**
@@ -235,10 +557,27 @@ public:
      * @return max queue size
      */
     size_t max_size() const {
-        return size_ - 1;
+        return static_cast<size_t>(records_.capacity());
+    }
+
+    /**
+     * Accessor for queue counters, "snapshot" can be called on them
+     * from any thread
+     * 
+     * @return queue counters
+     */
+    const Stats& stats() const {
+        return stats_;
     }
 };
 
+/**
+ * Single producer single consumer queue with the capacity specified
+ * at compile time, records are stored inline without heap allocation
+ */
+template<typename T, uint32_t Capacity>
+using static_producer_consumer_queue = producer_consumer_queue<T, no_queue_stats, Capacity>;
+
 }
 } //namespace
 
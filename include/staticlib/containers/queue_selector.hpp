@@ -0,0 +1,161 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   queue_selector.hpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#ifndef STATICLIB_CONTAINERS_QUEUE_SELECTOR_HPP
+#define	STATICLIB_CONTAINERS_QUEUE_SELECTOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <vector>
+
+#include "staticlib/containers/detail/eventcount.hpp"
+
+namespace staticlib {
+namespace containers {
+
+/**
+ * Allows one thread to wait on a number of queues at once. Queues are
+ * attached to the selector with "set_selector" and notify it when
+ * new elements are added, waiting thread spins for a short time and then
+ * parks on the shared eventcount until one of the queues becomes non-empty.
+ * Queues are checked with non-locking "empty_guess", so the element found
+ * by "wait_any" may be taken by another consumer before it is polled.
+ */
+class queue_selector {
+    detail::eventcount not_empty;
+    std::atomic<bool> blocking;
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other instance
+     */
+    queue_selector(const queue_selector&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other instance
+     * @return reference to self
+     */
+    queue_selector& operator=(const queue_selector&) = delete;
+
+    template<typename Queue>
+    static bool find_ready(int& idx, int current, Queue& queue) {
+        if (!queue.empty_guess()) {
+            idx = current;
+            return true;
+        }
+        return false;
+    }
+
+    template<typename Queue, typename... Rest>
+    static bool find_ready(int& idx, int current, Queue& queue, Rest&... rest) {
+        return find_ready(idx, current, queue) || find_ready(idx, current + 1, rest...);
+    }
+
+public:
+    /**
+     * Constructor
+     */
+    queue_selector() :
+    blocking(true) { }
+
+    /**
+     * Wakes up the threads waiting on this selector, called by
+     * the attached queues after elements were added
+     */
+    void notify() {
+        not_empty.notify_all();
+    }
+
+    /**
+     * Waits until one of the specified queues becomes non-empty, queues
+     * must be attached to this selector. Queues are checked in the order
+     * they are specified, so the first queue has the highest priority.
+     *
+     * @param timeout_millis max amount of milliseconds to wait,
+     *        negative value will cause infinite wait
+     * @param queues queues to wait on
+     * @return index of the first non-empty queue, -1 if all queues
+     *         were empty after timeout or selector was unblocked
+     */
+    template<typename... Queues>
+    int wait_any(int32_t timeout_millis, Queues&... queues) {
+        int idx = -1;
+        detail::spin_then_park(not_empty, blocking, timeout_millis, [&idx, &queues...] {
+            return find_ready(idx, 0, queues...);
+        });
+        return idx;
+    }
+
+    /**
+     * Waits until one of the specified queues becomes non-empty, queues
+     * must be attached to this selector. Queues are checked in the order
+     * they are specified, so the first queue has the highest priority.
+     *
+     * @param queues queues to wait on
+     * @param timeout_millis max amount of milliseconds to wait,
+     *        negative value will cause infinite wait
+     * @return index of the first non-empty queue, -1 if all queues
+     *         were empty after timeout or selector was unblocked
+     */
+    template<typename Queue>
+    int wait_any_of(const std::vector<Queue*>& queues, int32_t timeout_millis = -1) {
+        int idx = -1;
+        detail::spin_then_park(not_empty, blocking, timeout_millis, [&idx, &queues] {
+            for (size_t i = 0; i < queues.size(); i++) {
+                if (!queues[i]->empty_guess()) {
+                    idx = static_cast<int>(i);
+                    return true;
+                }
+            }
+            return false;
+        });
+        return idx;
+    }
+
+    /**
+     * Unblocks the selector allowing threads to exit 'wait_any' calls.
+     * Selector cannot be used for waiting on it after this call.
+     */
+    void unblock() {
+        blocking.store(false, std::memory_order_release);
+        not_empty.notify_all();
+    }
+
+    /**
+     * Checks whether this selector was unblocked
+     *
+     * @return whether this selector was unblocked
+     */
+    bool is_blocking() const {
+        return blocking.load(std::memory_order_acquire);
+    }
+};
+
+}
+} // namespace
+
+#endif	/* STATICLIB_CONTAINERS_QUEUE_SELECTOR_HPP */
@@ -0,0 +1,218 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   queue_stats.hpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#ifndef STATICLIB_CONTAINERS_QUEUE_STATS_HPP
+#define	STATICLIB_CONTAINERS_QUEUE_STATS_HPP
+
+#include <cstdint>
+#include <atomic>
+
+#include "staticlib/containers/detail/cache_line.hpp"
+
+namespace staticlib {
+namespace containers {
+
+/**
+ * Point-in-time copy of the queue counters
+ */
+struct queue_stats_snapshot {
+    /**
+     * Total number of elements added to the queue
+     */
+    uint64_t enqueued = 0;
+    /**
+     * Total number of elements removed from the queue
+     */
+    uint64_t dequeued = 0;
+    /**
+     * Number of attempts to add elements rejected because the queue was full
+     */
+    uint64_t rejected = 0;
+    /**
+     * Max number of elements observed in the queue
+     */
+    uint64_t high_water_mark = 0;
+    /**
+     * Total time in nanoseconds spent by consumers waiting on empty queue
+     */
+    uint64_t wait_nanos = 0;
+    /**
+     * Number of times the queue lock was found taken by other thread
+     */
+    uint64_t contended = 0;
+};
+
+/**
+ * Default stats policy for queues, all the methods are no-op 
+ * and are compiled out
+ */
+class no_queue_stats {
+public:
+    /**
+     * Whether stats are collected
+     */
+    static const bool enabled = false;
+
+    void on_enqueue(uint64_t, uint64_t) { }
+
+    void on_reject() { }
+
+    void on_dequeue(uint64_t) { }
+
+    void on_wait(uint64_t) { }
+
+    void on_contention() { }
+
+    /**
+     * Returns empty snapshot
+     * 
+     * @return empty snapshot
+     */
+    queue_stats_snapshot snapshot() const {
+        return queue_stats_snapshot();
+    }
+};
+
+/**
+ * Stats policy for queues that keeps relaxed atomic counters.
+ * Producer-side ("on_enqueue", "on_reject") and consumer-side ("on_dequeue",
+ * "on_wait") counters are placed on separate cache lines. Calls that update 
+ * the counters of one side must not run concurrently (queue either holds 
+ * a lock or there is only one thread on each side), so the counters are 
+ * updated with plain load/store instead of read-modify-write operations.
+ * "snapshot" can be called from any thread at any time.
+ */
+class queue_stats {
+    char pad0[detail::cache_line_size];
+    std::atomic<uint64_t> enqueued;
+    std::atomic<uint64_t> rejected;
+    std::atomic<uint64_t> high_water_mark;
+    std::atomic<uint64_t> contended;
+    char pad1[detail::cache_line_size];
+    std::atomic<uint64_t> dequeued;
+    std::atomic<uint64_t> wait_nanos;
+    char pad2[detail::cache_line_size];
+
+    static void add(std::atomic<uint64_t>& counter, uint64_t value) {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    queue_stats(const queue_stats&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return reference to self
+     */
+    queue_stats& operator=(const queue_stats&) = delete;
+
+public:
+    /**
+     * Whether stats are collected
+     */
+    static const bool enabled = true;
+
+    /**
+     * Constructor
+     */
+    queue_stats() :
+    enqueued(0),
+    rejected(0),
+    high_water_mark(0),
+    contended(0),
+    dequeued(0),
+    wait_nanos(0) { }
+
+    /**
+     * Records added elements, called by producer
+     * 
+     * @param count number of added elements
+     * @param size queue size after addition
+     */
+    void on_enqueue(uint64_t count, uint64_t size) {
+        add(enqueued, count);
+        if (size > high_water_mark.load(std::memory_order_relaxed)) {
+            high_water_mark.store(size, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Records rejected addition, called by producer
+     */
+    void on_reject() {
+        add(rejected, 1);
+    }
+
+    /**
+     * Records removed elements, called by consumer
+     * 
+     * @param count number of removed elements
+     */
+    void on_dequeue(uint64_t count) {
+        add(dequeued, count);
+    }
+
+    /**
+     * Records the time spent waiting on empty queue, called by consumer
+     * 
+     * @param nanos wait time in nanoseconds
+     */
+    void on_wait(uint64_t nanos) {
+        add(wait_nanos, nanos);
+    }
+
+    /**
+     * Records lock contention, must be called after the lock was acquired
+     */
+    void on_contention() {
+        add(contended, 1);
+    }
+
+    /**
+     * Reads all counters without locking, counters are read one 
+     * by one so the snapshot may be slightly inconsistent under load
+     * 
+     * @return snapshot of the counters
+     */
+    queue_stats_snapshot snapshot() const {
+        queue_stats_snapshot res;
+        res.enqueued = enqueued.load(std::memory_order_relaxed);
+        res.dequeued = dequeued.load(std::memory_order_relaxed);
+        res.rejected = rejected.load(std::memory_order_relaxed);
+        res.high_water_mark = high_water_mark.load(std::memory_order_relaxed);
+        res.wait_nanos = wait_nanos.load(std::memory_order_relaxed);
+        res.contended = contended.load(std::memory_order_relaxed);
+        return res;
+    }
+};
+
+}
+} // namespace
+
+#endif	/* STATICLIB_CONTAINERS_QUEUE_STATS_HPP */
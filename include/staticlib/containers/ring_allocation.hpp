@@ -0,0 +1,78 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   ring_allocation.hpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#ifndef STATICLIB_CONTAINERS_RING_ALLOCATION_HPP
+#define	STATICLIB_CONTAINERS_RING_ALLOCATION_HPP
+
+#include <cstddef>
+
+#include "staticlib/containers/detail/cache_line.hpp"
+
+namespace staticlib {
+namespace containers {
+
+/**
+ * Options for the allocation of the ring storage of "producer_consumer_queue".
+ * Huge pages and NUMA placement are supported only on Linux and are
+ * treated as hints: when the system cannot satisfy them, storage is
+ * allocated with regular pages and default placement.
+ */
+struct ring_allocation {
+    /**
+     * Alignment of the storage in bytes, must be a power of two,
+     * cache line by default, mapped storage is always page-aligned
+     */
+    size_t alignment;
+
+    /**
+     * Whether to back the storage with 2MB huge pages, "MAP_HUGETLB"
+     * is tried first, then transparent huge pages are requested with "madvise"
+     */
+    bool huge_pages;
+
+    /**
+     * NUMA node to place the storage on, negative value
+     * (used by default) means default placement
+     */
+    int numa_node;
+
+    /**
+     * Whether to touch all pages of the storage on creation, so there
+     * are no page faults on the first use
+     */
+    bool prefault;
+
+    /**
+     * Constructor, sets default options
+     */
+    ring_allocation() :
+    alignment(detail::cache_line_size),
+    huge_pages(false),
+    numa_node(-1),
+    prefault(false) { }
+};
+
+}
+} // namespace
+
+#endif	/* STATICLIB_CONTAINERS_RING_ALLOCATION_HPP */
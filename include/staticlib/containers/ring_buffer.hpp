@@ -0,0 +1,302 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   ring_buffer.hpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#ifndef STATICLIB_CONTAINERS_RING_BUFFER_HPP
+#define	STATICLIB_CONTAINERS_RING_BUFFER_HPP
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace staticlib {
+namespace containers {
+
+/**
+ * Growable FIFO ring buffer over a single contiguous allocation,
+ * not synchronized. Memory is allocated only when the buffer grows 
+ * beyond its current capacity (capacity is doubled), so 'reserve'd buffer 
+ * never touches the heap on 'emplace_back'/'pop_front'. 
+ * Can be used as a storage for "blocking_queue" instead of "std::deque".
+ */
+template<typename T, typename Allocator = std::allocator<T>>
+class ring_buffer {
+    typedef std::allocator_traits<Allocator> traits;
+
+    Allocator alloc;
+    T* records = nullptr;
+    size_t cap = 0;
+    size_t head = 0;
+    size_t count = 0;
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    ring_buffer(const ring_buffer&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return reference to self
+     */
+    ring_buffer& operator=(const ring_buffer&) = delete;
+
+    size_t index(size_t pos) const {
+        size_t idx = head + pos;
+        return idx < cap ? idx : idx - cap;
+    }
+
+    void reallocate(size_t new_cap) {
+        T* new_records = traits::allocate(alloc, new_cap);
+        size_t moved = 0;
+        try {
+            for (; moved < count; moved++) {
+                traits::construct(alloc, new_records + moved, std::move_if_noexcept(records[index(moved)]));
+            }
+        } catch (...) {
+            for (size_t i = 0; i < moved; i++) {
+                traits::destroy(alloc, new_records + i);
+            }
+            traits::deallocate(alloc, new_records, new_cap);
+            throw;
+        }
+        size_t old_count = count;
+        clear();
+        if (nullptr != records) {
+            traits::deallocate(alloc, records, cap);
+        }
+        records = new_records;
+        cap = new_cap;
+        count = old_count;
+    }
+
+public:
+    /**
+     * Type of elements
+     */
+    typedef T value_type;
+
+    /**
+     * Type of allocator
+     */
+    typedef Allocator allocator_type;
+
+    /**
+     * Constructor, no memory is allocated
+     */
+    ring_buffer() { }
+
+    /**
+     * Constructor, no memory is allocated
+     * 
+     * @param alloc allocator to use
+     */
+    explicit ring_buffer(const Allocator& alloc) :
+    alloc(alloc) { }
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    ring_buffer(ring_buffer&& other) :
+    alloc(std::move(other.alloc)),
+    records(other.records),
+    cap(other.cap),
+    head(other.head),
+    count(other.count) {
+        other.records = nullptr;
+        other.cap = 0;
+        other.head = 0;
+        other.count = 0;
+    }
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return reference to self
+     */
+    ring_buffer& operator=(ring_buffer&& other) {
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * Destructor
+     */
+    ~ring_buffer() {
+        clear();
+        if (nullptr != records) {
+            traits::deallocate(alloc, records, cap);
+        }
+    }
+
+    /**
+     * Ensures that the buffer can hold the specified number 
+     * of elements without reallocation
+     * 
+     * @param new_cap required capacity
+     */
+    void reserve(size_t new_cap) {
+        if (new_cap > cap) {
+            reallocate(new_cap);
+        }
+    }
+
+    /**
+     * Emplace a value at the end of the buffer, capacity is doubled
+     * if the buffer is full
+     * 
+     * @param recordArgs constructor arguments for buffer element
+     */
+    template<typename ...Args>
+    void emplace_back(Args&&... record_args) {
+        if (count == cap) {
+            reallocate(cap > 0 ? cap * 2 : 16);
+        }
+        traits::construct(alloc, records + index(count), std::forward<Args>(record_args)...);
+        count += 1;
+    }
+
+    /**
+     * Removes the value from the front of the buffer,
+     * buffer must not be empty
+     */
+    void pop_front() {
+        traits::destroy(alloc, records + head);
+        head += 1;
+        if (head == cap) {
+            head = 0;
+        }
+        count -= 1;
+    }
+
+    /**
+     * Accessor for the value at the front of the buffer,
+     * buffer must not be empty
+     * 
+     * @return reference to the value
+     */
+    T& front() {
+        return records[head];
+    }
+
+    /**
+     * Accessor for the value at the front of the buffer,
+     * buffer must not be empty
+     * 
+     * @return reference to the value
+     */
+    const T& front() const {
+        return records[head];
+    }
+
+    /**
+     * Accessor for the value at the end of the buffer,
+     * buffer must not be empty
+     * 
+     * @return reference to the value
+     */
+    T& back() {
+        return records[index(count - 1)];
+    }
+
+    /**
+     * Accessor for the value at the specified position from the front
+     * 
+     * @param pos position, must be less than size
+     * @return reference to the value
+     */
+    T& operator[](size_t pos) {
+        return records[index(pos)];
+    }
+
+    /**
+     * Destroys all values, capacity is not changed
+     */
+    void clear() {
+        while (count > 0) {
+            pop_front();
+        }
+        head = 0;
+    }
+
+    /**
+     * Swaps contents (including allocators) with other buffer
+     * 
+     * @param other other instance
+     */
+    void swap(ring_buffer& other) {
+        using std::swap;
+        swap(alloc, other.alloc);
+        swap(records, other.records);
+        swap(cap, other.cap);
+        swap(head, other.head);
+        swap(count, other.count);
+    }
+
+    /**
+     * Check if the buffer is empty
+     * 
+     * @return whether buffer is empty
+     */
+    bool empty() const {
+        return 0 == count;
+    }
+
+    /**
+     * Returns the number of entries in the buffer
+     * 
+     * @return number of entries in the buffer
+     */
+    size_t size() const {
+        return count;
+    }
+
+    /**
+     * Returns the number of entries the buffer can hold
+     * without reallocation
+     * 
+     * @return capacity
+     */
+    size_t capacity() const {
+        return cap;
+    }
+
+    /**
+     * Accessor for the allocator
+     * 
+     * @return copy of the allocator
+     */
+    Allocator get_allocator() const {
+        return alloc;
+    }
+};
+
+}
+} // namespace
+
+#endif	/* STATICLIB_CONTAINERS_RING_BUFFER_HPP */
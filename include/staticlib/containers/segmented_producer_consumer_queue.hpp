@@ -0,0 +1,252 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   segmented_producer_consumer_queue.hpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#ifndef STATICLIB_CONTAINERS_SEGMENTED_PRODUCER_CONSUMER_QUEUE_HPP
+#define	STATICLIB_CONTAINERS_SEGMENTED_PRODUCER_CONSUMER_QUEUE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <utility>
+
+#include "staticlib/containers/producer_consumer_queue.hpp"
+#include "staticlib/containers/detail/cache_line.hpp"
+
+namespace staticlib {
+namespace containers {
+
+/**
+ * One producer and one consumer unbounded lock-free queue built from
+ * the linked fixed-size "producer_consumer_queue" segments. Producer links
+ * a new segment when the current one is full, consumer moves to the next
+ * segment when the current one is drained and hands the drained segment
+ * back to producer for reuse (through another "producer_consumer_queue"
+ * in the opposite direction). Producer allocates only when there are no
+ * segments to reuse.
+ */
+template<typename T>
+class segmented_producer_consumer_queue {
+    struct segment {
+        producer_consumer_queue<T> ring;
+        std::atomic<segment*> next;
+
+        explicit segment(uint32_t size) :
+        ring(size),
+        next(nullptr) { }
+    };
+
+    const uint32_t segment_size_;
+    // drained segments, consumer is the producer of this queue
+    producer_consumer_queue<segment*> spare;
+
+    // owned by producer
+    char pad0[detail::cache_line_size];
+    segment* tail;
+
+    // owned by consumer
+    char pad1[detail::cache_line_size];
+    segment* head;
+
+    char pad2[detail::cache_line_size];
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other instance
+     */
+    segmented_producer_consumer_queue(const segmented_producer_consumer_queue&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other instance
+     * @return reference to self
+     */
+    segmented_producer_consumer_queue& operator=(const segmented_producer_consumer_queue&) = delete;
+
+    // called by producer
+    segment* acquire_segment() {
+        segment* res = nullptr;
+        if (spare.poll(res)) {
+            // consumer does not access recycled segment
+            res->next.store(nullptr, std::memory_order_relaxed);
+            return res;
+        }
+        return new segment(segment_size_);
+    }
+
+    // called by consumer, returns false if there are no more segments
+    bool advance_head() {
+        segment* next = head->next.load(std::memory_order_acquire);
+        if (nullptr == next) {
+            return false;
+        }
+        // records added before linking are visible after the acquire load
+        if (!head->ring.is_empty()) {
+            return true;
+        }
+        segment* drained = head;
+        head = next;
+        if (!spare.emplace(drained)) {
+            delete drained;
+        }
+        return true;
+    }
+
+public:
+    /**
+     * Type of elements
+     */
+    typedef T value_type;
+
+    /**
+     * Constructor
+     *
+     * @param segment_size number of elements in each segment, must be >= 1
+     * @param max_spare_segments max number of drained segments kept for reuse
+     */
+    explicit segmented_producer_consumer_queue(uint32_t segment_size = 1024, uint32_t max_spare_segments = 4) :
+    segment_size_(segment_size > 0 ? segment_size : 1),
+    spare(max_spare_segments > 0 ? max_spare_segments : 1),
+    tail(new segment(segment_size_)),
+    head(tail) { }
+
+    /**
+     * Destructor, destroys the elements left in the queue
+     */
+    ~segmented_producer_consumer_queue() {
+        segment* seg = head;
+        while (nullptr != seg) {
+            segment* next = seg->next.load(std::memory_order_relaxed);
+            delete seg;
+            seg = next;
+        }
+        segment* sp = nullptr;
+        while (spare.poll(sp)) {
+            delete sp;
+        }
+    }
+
+    /**
+     * Emplace a value at the end of the queue, can be called only by producer.
+     * Links new segment if the current one is full.
+     *
+     * @param recordArgs constructor arguments for queue element
+     */
+    template<class ...Args>
+    void emplace(Args&&... record_args) {
+        if (tail->ring.emplace(std::forward<Args>(record_args)...)) {
+            return;
+        }
+        std::unique_ptr<segment> seg{acquire_segment()};
+        // cannot fail on empty segment
+        seg->ring.emplace(std::forward<Args>(record_args)...);
+        segment* linked = seg.release();
+        tail->next.store(linked, std::memory_order_release);
+        tail = linked;
+    }
+
+    /**
+     * Attempt to read the value at the front to the queue into a variable,
+     * can be called only by consumer
+     *
+     * @param record move (or copy) the value at the front of the queue to given variable
+     * @return false if queue was empty, true otherwise
+     */
+    bool poll(T& record) {
+        do {
+            if (head->ring.poll(record)) {
+                return true;
+            }
+        } while (advance_head());
+        return false;
+    }
+
+    /**
+     * Consume all the values currently available in this queue into
+     * specified functor, read index of each segment is published once
+     * for all its elements, can be called only by consumer
+     *
+     * @param func functor to consume contents
+     * @return number of elements consumed
+     */
+    template<typename Func>
+    size_t consume(Func func) {
+        size_t count = 0;
+        do {
+            count += head->ring.consume(func);
+        } while (advance_head());
+        return count;
+    }
+
+    /**
+     * Retrieve a pointer to the item at the front of the queue,
+     * can be called only by consumer
+     *
+     * @return a pointer to the item, nullptr if it is empty
+     */
+    T* front_ptr() {
+        do {
+            T* res = head->ring.front_ptr();
+            if (nullptr != res) {
+                return res;
+            }
+        } while (advance_head());
+        return nullptr;
+    }
+
+    /**
+     * Destroy the item at the front of the queue in place, can be called
+     * only by consumer after successful "front_ptr" call
+     *
+     * @return false if queue was empty, true otherwise
+     */
+    bool pop_front() {
+        return head->ring.pop_front();
+    }
+
+    /**
+     * Check if the queue is empty, can be called only by consumer
+     *
+     * @return whether queue is empty
+     */
+    bool is_empty() const {
+        // new segment is linked only with an element in it
+        return head->ring.is_empty() && nullptr == head->next.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Accessor for segment size specified at creation
+     *
+     * @return number of elements in each segment
+     */
+    size_t segment_size() const {
+        return segment_size_;
+    }
+};
+
+}
+} // namespace
+
+#endif	/* STATICLIB_CONTAINERS_SEGMENTED_PRODUCER_CONSUMER_QUEUE_HPP */
@@ -0,0 +1,295 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   sharded_blocking_queue.hpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#ifndef STATICLIB_CONTAINERS_SHARDED_BLOCKING_QUEUE_HPP
+#define	STATICLIB_CONTAINERS_SHARDED_BLOCKING_QUEUE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "staticlib/containers/blocking_queue.hpp"
+#include "staticlib/containers/detail/cache_line.hpp"
+#include "staticlib/containers/detail/eventcount.hpp"
+
+namespace staticlib {
+namespace containers {
+
+/**
+ * Strategy of choosing the lane for the new element in "sharded_blocking_queue"
+ */
+enum class lane_selection {
+    /**
+     * Each producer thread always uses the same lane
+     */
+    thread_affinity,
+    /**
+     * Lanes are used in turn by all producers
+     */
+    round_robin
+};
+
+/**
+ * Multiple producers multiple consumers queue that spreads elements
+ * over a number of "blocking_queue" lanes, each lane has its own lock.
+ * Consumers check their home lane (chosen by thread) first and then
+ * scan other lanes, waiting consumers spin and then park on a shared
+ * eventcount. Elements are FIFO only within a lane, there is no global
+ * ordering between the elements added to different lanes.
+ */
+template<typename T>
+class sharded_blocking_queue {
+    struct lane {
+        blocking_queue<T> queue;
+        // allows to skip the lane lock when it is empty
+        std::atomic<size_t> count;
+        char pad[detail::cache_line_size];
+
+        explicit lane(size_t max_size) :
+        queue(max_size),
+        count(0) { }
+    };
+
+    std::vector<std::unique_ptr<lane>> lanes;
+    const lane_selection selection;
+    std::atomic<size_t> next_lane;
+    detail::eventcount not_empty;
+    std::atomic<bool> blocking;
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other instance
+     */
+    sharded_blocking_queue(const sharded_blocking_queue&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other instance
+     * @return reference to self
+     */
+    sharded_blocking_queue& operator=(const sharded_blocking_queue&) = delete;
+
+    size_t thread_lane() const {
+        return std::hash<std::thread::id>()(std::this_thread::get_id()) % lanes.size();
+    }
+
+    size_t producer_lane() {
+        if (lane_selection::round_robin == selection) {
+            return next_lane.fetch_add(1, std::memory_order_relaxed) % lanes.size();
+        }
+        return thread_lane();
+    }
+
+    template<typename ...Args>
+    bool emplace_to_lane(lane& la, Args&&... record_args) {
+        // incremented first, so consumers never decrement it below zero
+        la.count.fetch_add(1, std::memory_order_seq_cst);
+        bool success = false;
+        try {
+            success = la.queue.emplace(std::forward<Args>(record_args)...);
+        } catch (...) {
+            la.count.fetch_sub(1, std::memory_order_seq_cst);
+            throw;
+        }
+        if (!success) {
+            la.count.fetch_sub(1, std::memory_order_seq_cst);
+        }
+        return success;
+    }
+
+    bool poll_lane(lane& la, T& record) {
+        if (0 == la.count.load(std::memory_order_seq_cst)) {
+            return false;
+        }
+        if (la.queue.poll(record)) {
+            la.count.fetch_sub(1, std::memory_order_seq_cst);
+            return true;
+        }
+        return false;
+    }
+
+public:
+    /**
+     * Type of elements
+     */
+    typedef T value_type;
+
+    /**
+     * Constructor
+     *
+     * @param lanes_count number of lanes, usually the number of producers
+     * @param max_lane_size bound size of each lane, lanes are unbounded by default
+     * @param selection strategy of choosing the lane for the new element
+     */
+    explicit sharded_blocking_queue(size_t lanes_count, size_t max_lane_size = 0,
+            lane_selection selection = lane_selection::thread_affinity) :
+    selection(selection),
+    next_lane(0),
+    blocking(true) {
+        size_t count = lanes_count > 0 ? lanes_count : 1;
+        for (size_t i = 0; i < count; i++) {
+            lanes.emplace_back(new lane(max_lane_size));
+        }
+    }
+
+    /**
+     * Emplace a value into the queue, if the chosen lane is full,
+     * other lanes are tried
+     *
+     * @param recordArgs constructor arguments for queue element
+     * @return false if all lanes were full, true otherwise
+     */
+    template<typename ...Args>
+    bool emplace(Args&&... record_args) {
+        size_t start = producer_lane();
+        for (size_t i = 0; i < lanes.size(); i++) {
+            lane& la = *lanes[(start + i) % lanes.size()];
+            // arguments are not consumed when the lane is full
+            if (emplace_to_lane(la, std::forward<Args>(record_args)...)) {
+                not_empty.notify_one();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Attempt to read a value from the home lane of the calling thread,
+     * or from any other lane. This method returns immediately.
+     *
+     * @param record move (or copy) the value to given variable
+     * @return returns false if queue was empty, true otherwise
+     */
+    bool poll(T& record) {
+        size_t start = thread_lane();
+        for (size_t i = 0; i < lanes.size(); i++) {
+            if (poll_lane(*lanes[(start + i) % lanes.size()], record)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Attempt to read a value from the home lane of the calling thread,
+     * or from any other lane. This method will spin and then park on empty
+     * queue infinitely (by default), or up to specified amount of milliseconds
+     *
+     * @param record move (or copy) the value to given variable
+     * @param timeout_millis max amount of milliseconds to wait on empty queue,
+     *        negative value (supplied by default) will cause infinite wait
+     * @return returns false if queue was empty after timeout or was unblocked,
+     *         true otherwise
+     */
+    bool take(T& record, int32_t timeout_millis = -1) {
+        return detail::spin_then_park(not_empty, blocking, timeout_millis, [this, &record] {
+            return this->poll(record);
+        });
+    }
+
+    /**
+     * Consume all the contents of all lanes into
+     * specified functor, contents of each lane are
+     * passed to the functor after unlocking that lane
+     *
+     * @param func functor to consume contents
+     * @return number of elements consumed
+     */
+    template<typename Func>
+    size_t consume(Func func) {
+        size_t count = 0;
+        for (auto& la : lanes) {
+            if (0 == la->count.load(std::memory_order_seq_cst)) {
+                continue;
+            }
+            std::atomic<size_t>& lane_count = la->count;
+            count += la->queue.drain_to([&lane_count, &func](T&& record) {
+                lane_count.fetch_sub(1, std::memory_order_seq_cst);
+                func(std::move(record));
+            });
+        }
+        return count;
+    }
+
+    /**
+     * Unblocks the queue allowing consumers to exit 'take' calls.
+     * Queue cannot be used for waiting on it after this call.
+     */
+    void unblock() {
+        blocking.store(false, std::memory_order_release);
+        not_empty.notify_all();
+    }
+
+    /**
+     * Checks whether this queue was unblocked
+     *
+     * @return whether this queue was unblocked
+     */
+    bool is_blocking() const {
+        return blocking.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Check if all the lanes are empty, result may be stale
+     * when called concurrently with other operations
+     *
+     * @return whether queue is empty
+     */
+    bool is_empty() const {
+        return 0 == size_guess();
+    }
+
+    /**
+     * Returns approximate number of entries in all lanes
+     *
+     * @return number of entries in the queue
+     */
+    size_t size_guess() const {
+        size_t res = 0;
+        for (auto& la : lanes) {
+            res += la->count.load(std::memory_order_relaxed);
+        }
+        return res;
+    }
+
+    /**
+     * Accessor for number of lanes specified at creation
+     *
+     * @return number of lanes
+     */
+    size_t lanes_count() const {
+        return lanes.size();
+    }
+};
+
+}
+} // namespace
+
+#endif	/* STATICLIB_CONTAINERS_SHARDED_BLOCKING_QUEUE_HPP */
@@ -0,0 +1,390 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   shared_producer_consumer_queue.hpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#ifndef STATICLIB_CONTAINERS_SHARED_PRODUCER_CONSUMER_QUEUE_HPP
+#define	STATICLIB_CONTAINERS_SHARED_PRODUCER_CONSUMER_QUEUE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+
+#include "staticlib/containers/detail/cache_line.hpp"
+#include "staticlib/containers/detail/ring_storage.hpp"
+
+namespace staticlib {
+namespace containers {
+
+/**
+ * Single producer single consumer lock-free queue that keeps its header
+ * (magic, version, capacity and indices) and records in a caller-provided
+ * buffer, for example in 'mmap'ed file or in POSIX shared memory segment.
+ * Buffer is initialized by "create" on one side and is opened with "attach"
+ * on the other side, each process (or thread) uses its own instance
+ * of this class. Records are copied in and out of the buffer as bytes,
+ * so only trivially-copyable types are supported. This class does not own
+ * the buffer, buffer must outlive all the instances attached to it.
+ */
+template<typename T>
+class shared_producer_consumer_queue {
+    static_assert(std::is_trivially_copyable<T>::value,
+            "shared queue elements must be trivially copyable");
+    static_assert(ATOMIC_LLONG_LOCK_FREE == 2,
+            "shared queue requires lock-free 64-bit atomics");
+
+    static const uint64_t magic_value = 0x474e495243535053ULL; // "SPSCRING"
+    static const uint32_t version_value = 1;
+
+    struct header {
+        std::atomic<uint64_t> magic;
+        uint32_t version;
+        uint32_t element_size;
+        uint64_t capacity;
+        uint64_t mask;
+        char pad0[detail::cache_line_size];
+        std::atomic<uint64_t> read_index;
+        char pad1[detail::cache_line_size];
+        std::atomic<uint64_t> write_index;
+        char pad2[detail::cache_line_size];
+    };
+
+    header* head;
+    T* records;
+    uint64_t capacity;
+    uint64_t mask;
+    // private copies of the other side's index
+    uint64_t read_index_cache = 0;
+    uint64_t write_index_cache = 0;
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other instance
+     */
+    shared_producer_consumer_queue(const shared_producer_consumer_queue&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other instance
+     * @return reference to self
+     */
+    shared_producer_consumer_queue& operator=(const shared_producer_consumer_queue&) = delete;
+
+    static size_t records_offset() {
+        size_t align = alignof(T) > detail::cache_line_size ? alignof(T) : detail::cache_line_size;
+        return (sizeof(header) + align - 1) / align * align;
+    }
+
+    static void check_buffer(void* buffer) {
+        if (nullptr == buffer) {
+            throw std::invalid_argument("shared queue buffer is null");
+        }
+        size_t align = alignof(T) > alignof(header) ? alignof(T) : alignof(header);
+        if (0 != reinterpret_cast<uintptr_t>(buffer) % align) {
+            throw std::invalid_argument("shared queue buffer is not aligned");
+        }
+    }
+
+    explicit shared_producer_consumer_queue(void* buffer) :
+    head(static_cast<header*>(buffer)),
+    records(reinterpret_cast<T*>(static_cast<char*>(buffer) + records_offset())),
+    capacity(head->capacity),
+    mask(head->mask),
+    read_index_cache(head->read_index.load(std::memory_order_acquire)),
+    write_index_cache(head->write_index.load(std::memory_order_acquire)) { }
+
+    T* slot(uint64_t index) {
+        return &records[index & mask];
+    }
+
+    // called by producer
+    bool has_space(uint64_t current_write) {
+        if (current_write - read_index_cache == capacity) {
+            read_index_cache = head->read_index.load(std::memory_order_acquire);
+            if (current_write - read_index_cache == capacity) {
+                // queue is full
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // called by consumer
+    bool has_records(uint64_t current_read) {
+        if (current_read == write_index_cache) {
+            write_index_cache = head->write_index.load(std::memory_order_acquire);
+            if (current_read == write_index_cache) {
+                // queue is empty
+                return false;
+            }
+        }
+        return true;
+    }
+
+public:
+    /**
+     * Type of elements
+     */
+    typedef T value_type;
+
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    shared_producer_consumer_queue(shared_producer_consumer_queue&& other) = default;
+
+    /**
+     * Returns the size of the buffer required for the queue with specified capacity,
+     * buffer must be aligned at least to the alignment of the element type
+     * and of the 64-bit integer
+     *
+     * @param capacity max number of elements in the queue
+     * @return size of the buffer in bytes
+     */
+    static size_t required_size(uint32_t capacity) {
+        return records_offset() + sizeof(T) * static_cast<size_t>(detail::ring_round_up_pow2(capacity));
+    }
+
+    /**
+     * Initializes the queue header in the specified buffer,
+     * contents of the buffer are overwritten
+     *
+     * @param buffer buffer to place the queue into
+     * @param buffer_size size of the buffer in bytes
+     * @param capacity max number of elements in the queue, must be >= 1
+     * @return queue instance operating on the specified buffer
+     * @throws std::invalid_argument if the buffer is too small or misaligned
+     */
+    static shared_producer_consumer_queue create(void* buffer, size_t buffer_size, uint32_t capacity) {
+        check_buffer(buffer);
+        if (0 == capacity) {
+            throw std::invalid_argument("shared queue capacity must be positive");
+        }
+        if (buffer_size < required_size(capacity)) {
+            throw std::invalid_argument("shared queue buffer is too small");
+        }
+        header* hd = new (buffer) header();
+        hd->version = version_value;
+        hd->element_size = static_cast<uint32_t>(sizeof(T));
+        hd->capacity = capacity;
+        hd->mask = detail::ring_round_up_pow2(capacity) - 1;
+        hd->read_index.store(0, std::memory_order_relaxed);
+        hd->write_index.store(0, std::memory_order_relaxed);
+        // attaching side checks magic first
+        hd->magic.store(magic_value, std::memory_order_release);
+        return shared_producer_consumer_queue(buffer);
+    }
+
+    /**
+     * Opens the queue previously initialized with "create" in the specified buffer
+     *
+     * @param buffer buffer containing the queue
+     * @param buffer_size size of the buffer in bytes
+     * @return queue instance operating on the specified buffer
+     * @throws std::invalid_argument if the buffer does not contain the queue
+     *         of the same version and element size
+     */
+    static shared_producer_consumer_queue attach(void* buffer, size_t buffer_size) {
+        check_buffer(buffer);
+        if (buffer_size < records_offset()) {
+            throw std::invalid_argument("shared queue buffer is too small");
+        }
+        header* hd = static_cast<header*>(buffer);
+        if (magic_value != hd->magic.load(std::memory_order_acquire)) {
+            throw std::invalid_argument("shared queue is not initialized");
+        }
+        if (version_value != hd->version) {
+            throw std::invalid_argument("shared queue version mismatch");
+        }
+        if (sizeof(T) != hd->element_size) {
+            throw std::invalid_argument("shared queue element size mismatch");
+        }
+        if (0 == hd->capacity || hd->capacity > UINT32_MAX ||
+                hd->mask + 1 != detail::ring_round_up_pow2(hd->capacity) ||
+                buffer_size < required_size(static_cast<uint32_t>(hd->capacity))) {
+            throw std::invalid_argument("shared queue header is corrupted");
+        }
+        return shared_producer_consumer_queue(buffer);
+    }
+
+    /**
+     * Copy a value to the end of the queue, called by producer
+     *
+     * @param record value to copy
+     * @return false if the queue was full, true otherwise
+     */
+    bool emplace(const T& record) {
+        auto const current_write = head->write_index.load(std::memory_order_relaxed);
+        if (!has_space(current_write)) {
+            return false;
+        }
+        new (slot(current_write)) T(record);
+        head->write_index.store(current_write + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Retrieve a pointer to the slot at the end of the queue, called by producer,
+     * value must be written into this slot before calling "commit".
+     * Repeated calls without "commit" return the same slot.
+     *
+     * @return pointer to the slot, nullptr if the queue is full
+     */
+    T* reserve() {
+        auto const current_write = head->write_index.load(std::memory_order_relaxed);
+        if (!has_space(current_write)) {
+            return nullptr;
+        }
+        return slot(current_write);
+    }
+
+    /**
+     * Publish the value written into the slot returned by "reserve",
+     * must be called only after successful "reserve"
+     */
+    void commit() {
+        auto const current_write = head->write_index.load(std::memory_order_relaxed);
+        head->write_index.store(current_write + 1, std::memory_order_release);
+    }
+
+    /**
+     * Attempt to copy the value at the front to the queue into a variable,
+     * called by consumer
+     *
+     * @param record variable to copy the value into
+     * @return false if queue was empty, true otherwise
+     */
+    bool poll(T& record) {
+        auto const current_read = head->read_index.load(std::memory_order_relaxed);
+        if (!has_records(current_read)) {
+            return false;
+        }
+        record = *slot(current_read);
+        head->read_index.store(current_read + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Copy up to the specified number of values from the front of the queue
+     * into the output iterator, read index is published once for the whole batch,
+     * called by consumer
+     *
+     * @param out output iterator to copy the values into
+     * @param max_count max number of values to read
+     * @return number of values read, zero if queue was empty
+     */
+    template<typename OutputIterator>
+    size_t poll_n(OutputIterator out, size_t max_count) {
+        auto current_read = head->read_index.load(std::memory_order_relaxed);
+        write_index_cache = head->write_index.load(std::memory_order_acquire);
+        size_t count = 0;
+        while (count < max_count && current_read != write_index_cache) {
+            *out = *slot(current_read);
+            ++out;
+            current_read += 1;
+            count += 1;
+        }
+        if (count > 0) {
+            head->read_index.store(current_read, std::memory_order_release);
+        }
+        return count;
+    }
+
+    /**
+     * Retrieve a pointer to the item at the front of the queue, called by consumer
+     *
+     * @return a pointer to the item, nullptr if it is empty
+     */
+    const T* front_ptr() {
+        auto const current_read = head->read_index.load(std::memory_order_relaxed);
+        if (!has_records(current_read)) {
+            return nullptr;
+        }
+        return slot(current_read);
+    }
+
+    /**
+     * Release the item at the front of the queue, can be used
+     * after "front_ptr" to consume the item without copying it out,
+     * called by consumer
+     *
+     * @return false if queue was empty, true otherwise
+     */
+    bool pop_front() {
+        auto const current_read = head->read_index.load(std::memory_order_relaxed);
+        if (!has_records(current_read)) {
+            return false;
+        }
+        head->read_index.store(current_read + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Check if the queue is empty
+     *
+     * @return whether queue is empty
+     */
+    bool is_empty() const {
+        return head->read_index.load(std::memory_order_acquire) ==
+                head->write_index.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Check if the queue is full
+     *
+     * @return whether queue is full
+     */
+    bool is_full() const {
+        auto const read = head->read_index.load(std::memory_order_acquire);
+        return head->write_index.load(std::memory_order_acquire) - read >= capacity;
+    }
+
+    /**
+     * Returns the number of entries in the queue,
+     * see "producer_consumer_queue::size_guess"
+     *
+     * @return number of entries in the queue
+     */
+    size_t size_guess() const {
+        auto const read = head->read_index.load(std::memory_order_acquire);
+        return static_cast<size_t>(head->write_index.load(std::memory_order_acquire) - read);
+    }
+
+    /**
+     * Accessor for max queue size specified at creation
+     *
+     * @return max queue size
+     */
+    size_t max_size() const {
+        return static_cast<size_t>(capacity);
+    }
+};
+
+}
+} // namespace
+
+#endif	/* STATICLIB_CONTAINERS_SHARED_PRODUCER_CONSUMER_QUEUE_HPP */
@@ -0,0 +1,245 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   work_stealing_deque.hpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#ifndef STATICLIB_CONTAINERS_WORK_STEALING_DEQUE_HPP
+#define	STATICLIB_CONTAINERS_WORK_STEALING_DEQUE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "staticlib/containers/detail/cache_line.hpp"
+#include "staticlib/containers/detail/ring_storage.hpp"
+
+namespace staticlib {
+namespace containers {
+
+/**
+ * Chase-Lev work-stealing deque, memory orderings follow
+ * "Correct and Efficient Work-Stealing for Weak Memory Models" (Le et al., 2013).
+ * Owner thread pushes and pops elements at the bottom without locks,
+ * any number of other threads can steal elements from the top.
+ * Storage grows when full, previous arrays are kept until destruction
+ * because thieves may still read from them. Elements are read speculatively
+ * by thieves, so only trivially-copyable elements (e.g. pointers to tasks)
+ * are supported.
+ */
+template<typename T>
+class work_stealing_deque {
+    static_assert(std::is_trivially_copyable<T>::value,
+            "work stealing deque elements must be trivially copyable");
+
+    class array {
+        const int64_t mask;
+        std::unique_ptr<std::atomic<T>[]> slots;
+
+    public:
+        explicit array(int64_t capacity) :
+        mask(capacity - 1),
+        slots(new std::atomic<T>[static_cast<size_t>(capacity)]) { }
+
+        int64_t capacity() const {
+            return mask + 1;
+        }
+
+        T get(int64_t idx) const {
+            return slots[static_cast<size_t>(idx & mask)].load(std::memory_order_relaxed);
+        }
+
+        void put(int64_t idx, const T& record) {
+            slots[static_cast<size_t>(idx & mask)].store(record, std::memory_order_relaxed);
+        }
+    };
+
+    // thieves side
+    char pad0[detail::cache_line_size];
+    std::atomic<int64_t> top;
+
+    // owner side
+    char pad1[detail::cache_line_size];
+    std::atomic<int64_t> bottom;
+    std::atomic<array*> buffer;
+    // all allocated arrays, accessed only by owner
+    std::vector<std::unique_ptr<array>> arrays;
+
+    char pad2[detail::cache_line_size];
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other instance
+     */
+    work_stealing_deque(const work_stealing_deque&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other instance
+     * @return reference to self
+     */
+    work_stealing_deque& operator=(const work_stealing_deque&) = delete;
+
+    array* grow(array* current, int64_t b, int64_t t) {
+        std::unique_ptr<array> grown{new array(current->capacity() * 2)};
+        for (int64_t i = t; i < b; i++) {
+            grown->put(i, current->get(i));
+        }
+        array* res = grown.get();
+        arrays.emplace_back(std::move(grown));
+        buffer.store(res, std::memory_order_release);
+        return res;
+    }
+
+public:
+    /**
+     * Type of elements
+     */
+    typedef T value_type;
+
+    /**
+     * Constructor
+     *
+     * @param initial_capacity initial storage size, rounded up to the power of two
+     */
+    explicit work_stealing_deque(size_t initial_capacity = 64) :
+    top(0),
+    bottom(0),
+    buffer(nullptr) {
+        int64_t cap = static_cast<int64_t>(detail::ring_round_up_pow2(initial_capacity > 1 ? initial_capacity : 2));
+        arrays.emplace_back(new array(cap));
+        buffer.store(arrays.back().get(), std::memory_order_relaxed);
+    }
+
+    /**
+     * Add an element at the bottom, can be called only by owner
+     *
+     * @param record element to add
+     */
+    void push(const T& record) {
+        int64_t b = bottom.load(std::memory_order_relaxed);
+        int64_t t = top.load(std::memory_order_acquire);
+        array* a = buffer.load(std::memory_order_relaxed);
+        if (b - t > a->capacity() - 1) {
+            a = grow(a, b, t);
+        }
+        a->put(b, record);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * Take the last added element from the bottom, can be called only by owner
+     *
+     * @param record variable to copy the element into
+     * @return false if deque was empty, true otherwise
+     */
+    bool pop(T& record) {
+        int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        array* a = buffer.load(std::memory_order_relaxed);
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top.load(std::memory_order_relaxed);
+        if (t > b) {
+            // empty
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+        T res = a->get(b);
+        if (t == b) {
+            // last element, race with thieves
+            bool won = top.compare_exchange_strong(t, t + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom.store(b + 1, std::memory_order_relaxed);
+            if (!won) {
+                return false;
+            }
+        }
+        record = res;
+        return true;
+    }
+
+    /**
+     * Take the oldest element from the top, can be called by any thread,
+     * retries when other thread took the same element concurrently
+     *
+     * @param record variable to copy the element into
+     * @return false if deque was empty, true otherwise
+     */
+    bool steal(T& record) {
+        for (;;) {
+            int64_t t = top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t b = bottom.load(std::memory_order_acquire);
+            if (t >= b) {
+                return false;
+            }
+            array* a = buffer.load(std::memory_order_acquire);
+            T res = a->get(t);
+            if (top.compare_exchange_strong(t, t + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                record = res;
+                return true;
+            }
+        }
+    }
+
+    /**
+     * Check if the deque is empty, result may be stale
+     * when called concurrently with other operations
+     *
+     * @return whether deque is empty
+     */
+    bool is_empty() const {
+        int64_t t = top.load(std::memory_order_acquire);
+        return bottom.load(std::memory_order_acquire) <= t;
+    }
+
+    /**
+     * Returns the number of elements in the deque, result may be stale
+     * when called concurrently with other operations
+     *
+     * @return number of elements in the deque
+     */
+    size_t size_guess() const {
+        int64_t t = top.load(std::memory_order_acquire);
+        int64_t diff = bottom.load(std::memory_order_acquire) - t;
+        return diff > 0 ? static_cast<size_t>(diff) : 0;
+    }
+
+    /**
+     * Returns current storage size, can be called only by owner
+     *
+     * @return current storage size
+     */
+    size_t capacity() const {
+        return static_cast<size_t>(buffer.load(std::memory_order_relaxed)->capacity());
+    }
+};
+
+}
+} // namespace
+
+#endif	/* STATICLIB_CONTAINERS_WORK_STEALING_DEQUE_HPP */
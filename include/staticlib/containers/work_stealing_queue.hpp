@@ -0,0 +1,210 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   work_stealing_queue.hpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#ifndef STATICLIB_CONTAINERS_WORK_STEALING_QUEUE_HPP
+#define	STATICLIB_CONTAINERS_WORK_STEALING_QUEUE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "staticlib/containers/blocking_queue.hpp"
+#include "staticlib/containers/work_stealing_deque.hpp"
+#include "staticlib/containers/detail/eventcount.hpp"
+
+namespace staticlib {
+namespace containers {
+
+/**
+ * Task distribution for a fixed set of worker threads: each worker owns
+ * a "work_stealing_deque", tasks submitted from outside of the workers
+ * go to the shared injector ("blocking_queue"). Worker looks for the next
+ * task in its own deque, then in the injector and then steals from other
+ * workers, idle workers spin and then park until new tasks are added.
+ * Worker methods with the worker index "idx" can be called only
+ * from the thread of that worker.
+ */
+template<typename T>
+class work_stealing_queue {
+    std::vector<std::unique_ptr<work_stealing_deque<T>>> deques;
+    blocking_queue<T> injector;
+    // allows to skip the injector lock when it is empty
+    std::atomic<size_t> injected;
+    detail::eventcount idle;
+    std::atomic<bool> blocking;
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other instance
+     */
+    work_stealing_queue(const work_stealing_queue&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other instance
+     * @return reference to self
+     */
+    work_stealing_queue& operator=(const work_stealing_queue&) = delete;
+
+public:
+    /**
+     * Type of elements
+     */
+    typedef T value_type;
+
+    /**
+     * Constructor
+     *
+     * @param workers_count number of workers
+     * @param deque_capacity initial capacity of each worker deque
+     */
+    explicit work_stealing_queue(size_t workers_count, size_t deque_capacity = 64) :
+    injected(0),
+    blocking(true) {
+        for (size_t i = 0; i < workers_count; i++) {
+            deques.emplace_back(new work_stealing_deque<T>(deque_capacity));
+        }
+    }
+
+    /**
+     * Add a task from the thread that is not a worker
+     *
+     * @param task task to add
+     */
+    void submit(const T& task) {
+        // incremented first, so consumers never decrement it below zero
+        injected.fetch_add(1, std::memory_order_seq_cst);
+        try {
+            injector.emplace(task);
+        } catch (...) {
+            injected.fetch_sub(1, std::memory_order_seq_cst);
+            throw;
+        }
+        idle.notify_one();
+    }
+
+    /**
+     * Add a task to the deque of the specified worker,
+     * can be called only by that worker
+     *
+     * @param idx worker index
+     * @param task task to add
+     */
+    void push(size_t idx, const T& task) {
+        deques[idx]->push(task);
+        idle.notify_one();
+    }
+
+    /**
+     * Attempt to find the next task for the specified worker,
+     * can be called only by that worker. This method returns immediately.
+     *
+     * @param idx worker index
+     * @param task variable to copy the task into
+     * @return false if no tasks were found, true otherwise
+     */
+    bool poll(size_t idx, T& task) {
+        if (deques[idx]->pop(task)) {
+            return true;
+        }
+        if (injected.load(std::memory_order_seq_cst) > 0 && injector.poll(task)) {
+            injected.fetch_sub(1, std::memory_order_seq_cst);
+            return true;
+        }
+        for (size_t i = 1; i < deques.size(); i++) {
+            size_t victim = (idx + i) % deques.size();
+            if (deques[victim]->steal(task)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Find the next task for the specified worker, can be called
+     * only by that worker. This method will spin and then park on empty
+     * queue infinitely (by default), or up to specified amount of milliseconds
+     *
+     * @param idx worker index
+     * @param task variable to copy the task into
+     * @param timeout_millis max amount of milliseconds to wait on empty queue,
+     *        negative value (supplied by default) will cause infinite wait
+     * @return false if no tasks were found after timeout or queue
+     *         was unblocked, true otherwise
+     */
+    bool take(size_t idx, T& task, int32_t timeout_millis = -1) {
+        return detail::spin_then_park(idle, blocking, timeout_millis, [this, idx, &task] {
+            return this->poll(idx, task);
+        });
+    }
+
+    /**
+     * Unblocks the queue allowing workers to exit 'take' calls
+     * when no tasks are left.
+     * Queue cannot be used for waiting on it after this call.
+     */
+    void unblock() {
+        blocking.store(false, std::memory_order_release);
+        idle.notify_all();
+    }
+
+    /**
+     * Checks whether this queue was unblocked
+     *
+     * @return whether this queue was unblocked
+     */
+    bool is_blocking() const {
+        return blocking.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Returns approximate number of tasks in all the deques and the injector
+     *
+     * @return number of tasks
+     */
+    size_t size_guess() const {
+        size_t res = injected.load(std::memory_order_relaxed);
+        for (auto& de : deques) {
+            res += de->size_guess();
+        }
+        return res;
+    }
+
+    /**
+     * Accessor for number of workers specified at creation
+     *
+     * @return number of workers
+     */
+    size_t workers_count() const {
+        return deques.size();
+    }
+};
+
+}
+} // namespace
+
+#endif	/* STATICLIB_CONTAINERS_WORK_STEALING_QUEUE_HPP */
@@ -0,0 +1,131 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   blocking_mpmc_queue_test.cpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#include "staticlib/containers/blocking_mpmc_queue.hpp"
+
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+namespace sc = staticlib::containers;
+
+const uint32_t ELEMENTS_COUNT = 1 << 10;
+
+void test_multi() {
+    sc::blocking_mpmc_queue<std::string> queue{16};
+    auto take = [&](size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            std::string el;
+            bool success = queue.take(el);
+            slassert(success);
+            slassert(42 == el.size());
+        }
+    };
+    auto put = [&](size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            bool success = queue.put(std::string(42, 'a'));
+            slassert(success);
+        }
+    };
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 3; i++) {
+        threads.emplace_back(put, ELEMENTS_COUNT * 2);
+    }
+    for (size_t i = 0; i < 6; i++) {
+        threads.emplace_back(take, ELEMENTS_COUNT);
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    slassert(queue.is_empty());
+}
+
+void test_take_wait() {
+    sc::blocking_mpmc_queue<std::string> queue{4};
+    std::thread producer([&queue] {
+        std::this_thread::sleep_for(std::chrono::milliseconds{200});
+        queue.emplace("aaa");
+    });
+    std::string el1;
+    slassert(!queue.take(el1, 100));
+    slassert("" == el1);
+    std::string el2;
+    slassert(queue.take(el2, 150));
+    slassert("aaa" == el2);
+    producer.join();
+}
+
+void test_put_wait() {
+    sc::blocking_mpmc_queue<int> queue{2};
+    slassert(queue.put(1));
+    slassert(queue.put(2));
+    slassert(!queue.put(3, 100));
+    std::thread consumer([&queue] {
+        std::this_thread::sleep_for(std::chrono::milliseconds{100});
+        int el = -1;
+        slassert(queue.take(el));
+        slassert(1 == el);
+    });
+    slassert(queue.put(3, 1000));
+    consumer.join();
+    slassert(2 == queue.size());
+}
+
+void test_unblock() {
+    sc::blocking_mpmc_queue<int> queue{2};
+    std::vector<std::thread> consumers;
+    for (size_t i = 0; i < 4; i++) {
+        consumers.emplace_back([&queue] {
+            int el = -1;
+            slassert(!queue.take(el));
+            slassert(-1 == el);
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    queue.unblock();
+    for (auto& th : consumers) {
+        th.join();
+    }
+    slassert(!queue.is_blocking());
+    slassert(queue.emplace(1));
+    slassert(queue.emplace(2));
+    slassert(!queue.put(3));
+}
+
+int main() {
+    try {
+        test_multi();
+        test_take_wait();
+        test_put_wait();
+        test_unblock();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,204 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   blocking_priority_queue_test.cpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#include "staticlib/containers/blocking_priority_queue.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+namespace sc = staticlib::containers;
+
+void test_order() {
+    sc::blocking_priority_queue<int> queue{};
+    std::vector<int> vec;
+    std::mt19937 rng{42};
+    for (int i = 0; i < 1000; i++) {
+        vec.push_back(static_cast<int>(rng() % 100));
+    }
+    for (int el : vec) {
+        slassert(queue.emplace(el));
+    }
+    slassert(1000 == queue.size());
+    std::sort(vec.begin(), vec.end(), std::greater<int>());
+    for (size_t i = 0; i < 500; i++) {
+        int el = -1;
+        slassert(queue.poll(el));
+        slassert(vec[i] == el);
+    }
+    std::vector<int> rest;
+    slassert(500 == queue.consume([&rest](int el) {
+        rest.push_back(el);
+    }));
+    slassert(std::equal(rest.begin(), rest.end(), vec.begin() + 500));
+    slassert(queue.is_empty());
+    int el = -1;
+    slassert(!queue.poll(el));
+}
+
+void test_compare() {
+    sc::blocking_priority_queue<std::string, std::greater<std::string>> queue{};
+    queue.emplace("foo");
+    queue.emplace("bar");
+    queue.emplace("baz");
+    std::string el;
+    slassert(queue.take(el));
+    slassert("bar" == el);
+    slassert(queue.take(el));
+    slassert("baz" == el);
+    slassert(queue.take(el));
+    slassert("foo" == el);
+}
+
+void test_reject() {
+    sc::blocking_priority_queue<int> queue{3};
+    slassert(queue.emplace(1));
+    slassert(queue.emplace(5));
+    slassert(queue.emplace(3));
+    slassert(queue.is_full());
+    slassert(!queue.emplace(10));
+    int el = -1;
+    slassert(queue.poll(el));
+    slassert(5 == el);
+    slassert(queue.emplace(10));
+}
+
+void test_evict() {
+    sc::blocking_priority_queue<int> queue{4, sc::overflow_policy::evict_lowest};
+    for (int el : {5, 2, 8, 4}) {
+        slassert(queue.emplace(el));
+    }
+    // evicts 2
+    slassert(queue.emplace(7));
+    // lowest itself
+    slassert(!queue.emplace(1));
+    // evicts 4
+    slassert(queue.emplace(9));
+    slassert(4 == queue.size());
+    std::vector<int> vec;
+    queue.consume([&vec](int el) {
+        vec.push_back(el);
+    });
+    slassert((std::vector<int>{9, 8, 7, 5}) == vec);
+    // randomized against sorted reference
+    sc::blocking_priority_queue<int> bounded{16, sc::overflow_policy::evict_lowest};
+    std::vector<int> all;
+    std::mt19937 rng{43};
+    for (int i = 0; i < 500; i++) {
+        int val = static_cast<int>(rng() % 1000);
+        all.push_back(val);
+        bounded.emplace(val);
+    }
+    std::sort(all.begin(), all.end(), std::greater<int>());
+    for (size_t i = 0; i < 16; i++) {
+        int el = -1;
+        slassert(bounded.poll(el));
+        slassert(all[i] == el);
+    }
+}
+
+void test_take_wait() {
+    sc::blocking_priority_queue<int> queue{};
+    int el = -1;
+    auto start = std::chrono::steady_clock::now();
+    slassert(!queue.take(el, 100));
+    slassert(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds{100});
+    std::thread producer([&queue] {
+        std::this_thread::sleep_for(std::chrono::milliseconds{50});
+        queue.emplace(42);
+    });
+    slassert(queue.take(el));
+    slassert(42 == el);
+    producer.join();
+}
+
+void test_unblock() {
+    sc::blocking_priority_queue<int> queue{};
+    std::thread consumer([&queue] {
+        int el = -1;
+        slassert(!queue.take(el));
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    queue.unblock();
+    consumer.join();
+    slassert(!queue.is_blocking());
+}
+
+void test_multi() {
+    sc::blocking_priority_queue<int> queue{};
+    const int producers_count = 4;
+    const int per_producer = 5000;
+    std::atomic<int> received{0};
+    std::vector<std::thread> consumers;
+    for (int i = 0; i < 4; i++) {
+        consumers.emplace_back([&queue, &received] {
+            int el = -1;
+            while (queue.take(el)) {
+                received.fetch_add(1);
+            }
+        });
+    }
+    std::vector<std::thread> producers;
+    for (int i = 0; i < producers_count; i++) {
+        producers.emplace_back([&queue, i] {
+            for (int j = 0; j < per_producer; j++) {
+                queue.emplace(i * per_producer + j);
+            }
+        });
+    }
+    for (auto& th : producers) {
+        th.join();
+    }
+    while (!queue.is_empty()) {
+        std::this_thread::yield();
+    }
+    queue.unblock();
+    for (auto& th : consumers) {
+        th.join();
+    }
+    slassert(producers_count * per_producer == received.load());
+}
+
+int main() {
+    try {
+        test_order();
+        test_compare();
+        test_reject();
+        test_evict();
+        test_take_wait();
+        test_unblock();
+        test_multi();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,258 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   blocking_producer_consumer_queue_test.cpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#include "staticlib/containers/blocking_producer_consumer_queue.hpp"
+
+#include <iostream>
+#include <chrono>
+#include <exception>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __cpp_impl_coroutine
+#include <coroutine>
+#endif // __cpp_impl_coroutine
+
+#include "staticlib/config/assert.hpp"
+
+namespace sc = staticlib::containers;
+
+const uint32_t ELEMENTS_COUNT = 1 << 10;
+
+void test_take() {
+    sc::blocking_producer_consumer_queue<std::string> queue{16};
+    std::thread producer([&queue] {
+        for (size_t i = 0; i < ELEMENTS_COUNT; i++) {
+            bool success = queue.put(std::string(42, 'a' + (i % 26)));
+            slassert(success);
+        }
+    });
+    for (size_t i = 0; i < ELEMENTS_COUNT; i++) {
+        std::string el;
+        bool success = queue.take(el);
+        slassert(success);
+        slassert(std::string(42, 'a' + (i % 26)) == el);
+    }
+    producer.join();
+    slassert(queue.is_empty());
+}
+
+void test_intermittent() {
+    sc::blocking_producer_consumer_queue<int> queue{4};
+    std::thread producer([&queue] {
+        for (int i = 0; i < 10; i++) {
+            slassert(queue.put(i));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{200});
+        for (int i = 10; i < 20; i++) {
+            slassert(queue.put(i));
+        }
+    });
+    for (int i = 0; i < 20; i++) {
+        int el = -1;
+        slassert(queue.take(el));
+        slassert(i == el);
+    }
+    producer.join();
+}
+
+void test_take_wait() {
+    sc::blocking_producer_consumer_queue<std::string> queue{4};
+    std::thread producer([&queue] {
+        std::this_thread::sleep_for(std::chrono::milliseconds{200});
+        queue.emplace("aaa");
+    });
+    std::string el1;
+    bool success1 = queue.take(el1, 100);
+    slassert(!success1);
+    slassert("" == el1);
+    std::string el2;
+    bool success2 = queue.take(el2, 150);
+    slassert(success2);
+    slassert("aaa" == el2);
+    std::string el3;
+    slassert(!queue.take(el3, 0));
+    producer.join();
+}
+
+void test_put_wait() {
+    sc::blocking_producer_consumer_queue<int> queue{2};
+    slassert(queue.put(1));
+    slassert(queue.put(2));
+    slassert(queue.is_full());
+    slassert(!queue.put(3, 100));
+    std::thread consumer([&queue] {
+        std::this_thread::sleep_for(std::chrono::milliseconds{100});
+        int el = -1;
+        slassert(queue.poll(el));
+        slassert(1 == el);
+    });
+    slassert(queue.put(3, 1000));
+    consumer.join();
+    std::vector<int> vec;
+    slassert(2 == queue.poll_n(std::back_inserter(vec), 8));
+    slassert(2 == vec[0]);
+    slassert(3 == vec[1]);
+}
+
+void test_unblock() {
+    sc::blocking_producer_consumer_queue<int> queue{1};
+    std::thread consumer([&queue] {
+        int el = -1;
+        bool success = queue.take(el);
+        slassert(!success);
+        slassert(-1 == el);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    queue.unblock();
+    consumer.join();
+    slassert(!queue.is_blocking());
+    // producer side
+    slassert(queue.emplace(1));
+    slassert(!queue.put(2));
+    int el = -1;
+    slassert(queue.take(el));
+    slassert(1 == el);
+    slassert(!queue.take(el));
+}
+
+void test_batch() {
+    sc::blocking_producer_consumer_queue<int> queue{8};
+    std::vector<int> vec{1, 2, 3};
+    slassert(3 == queue.emplace_range(vec));
+    slassert(3 == queue.size_guess());
+    int sum = 0;
+    slassert(3 == queue.consume([&sum](int el) { sum += el; }));
+    slassert(6 == sum);
+    slassert(8 == queue.max_size());
+}
+
+#ifdef __cpp_impl_coroutine
+struct detached_task {
+    struct promise_type {
+        detached_task get_return_object() {
+            return detached_task{};
+        }
+
+        std::suspend_never initial_suspend() noexcept {
+            return {};
+        }
+
+        std::suspend_never final_suspend() noexcept {
+            return {};
+        }
+
+        void return_void() { }
+
+        void unhandled_exception() {
+            std::terminate();
+        }
+    };
+};
+
+detached_task take_async(sc::blocking_producer_consumer_queue<int>& queue, std::vector<int>& out, bool& done) {
+    int el = 0;
+    while (co_await queue.async_take(el)) {
+        out.push_back(el);
+    }
+    done = true;
+}
+
+detached_task put_async(sc::blocking_producer_consumer_queue<int>& queue, int count, bool& done) {
+    for (int i = 0; i < count; i++) {
+        if (!co_await queue.async_put(i)) {
+            break;
+        }
+    }
+    done = true;
+}
+
+void test_coroutines() {
+    const int count = 100000;
+    sc::blocking_producer_consumer_queue<int> queue{16};
+    std::vector<int> out;
+    bool taken = false;
+    take_async(queue, out, taken);
+    slassert(out.empty());
+    slassert(queue.emplace(42));
+    slassert(1 == out.size());
+    // consumer coroutine is resumed on the producer thread
+    std::thread producer([&queue, count] {
+        for (int i = 0; i < count; i++) {
+            slassert(queue.put(i));
+        }
+        queue.unblock();
+    });
+    producer.join();
+    slassert(taken);
+    slassert(static_cast<size_t>(count + 1) == out.size());
+    for (int i = 0; i < count; i++) {
+        slassert(i == out[i + 1]);
+    }
+
+    // producer coroutine is resumed on the consumer thread
+    sc::blocking_producer_consumer_queue<int> full{16};
+    bool put_done = false;
+    put_async(full, count, put_done);
+    slassert(!put_done);
+    std::thread consumer([&full, count] {
+        int el = -1;
+        for (int i = 0; i < count; i++) {
+            slassert(full.take(el));
+            slassert(i == el);
+        }
+    });
+    consumer.join();
+    slassert(put_done);
+    slassert(full.is_empty());
+    // unblock cancels the waiting producer
+    for (int i = 0; i < 16; i++) {
+        slassert(full.emplace(i));
+    }
+    put_done = false;
+    put_async(full, 1, put_done);
+    slassert(!put_done);
+    full.unblock();
+    slassert(put_done);
+}
+#else // __cpp_impl_coroutine
+void test_coroutines() { }
+#endif // __cpp_impl_coroutine
+
+int main() {
+    try {
+        test_take();
+        test_intermittent();
+        test_take_wait();
+        test_put_wait();
+        test_unblock();
+        test_batch();
+        test_coroutines();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -22,13 +22,21 @@
  */
 
 #include "staticlib/containers/blocking_queue.hpp"
+#include "staticlib/containers/ring_buffer.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <iostream>
 #include <string>
 #include <thread>
 #include <vector>
 #include <sstream>
 
+#ifdef __cpp_impl_coroutine
+#include <coroutine>
+#endif // __cpp_impl_coroutine
+
 #include "staticlib/config/assert.hpp"
 
 namespace sc = staticlib::containers;
@@ -276,6 +284,441 @@ void test_integral() {
     slassert(!queue.poll(taken));
 }
 
+void test_put_wait() {
+    sc::blocking_queue<my_movable_str> queue{2};
+    slassert(queue.put("aaa"));
+    slassert(queue.put("bbb"));
+    slassert(queue.is_full());
+    // not yet available
+    slassert(!queue.put("ccc", 100));
+    std::thread consumer([&queue] {
+        std::this_thread::sleep_for(std::chrono::milliseconds{100});
+        my_movable_str el{""};
+        bool success = queue.take(el);
+        slassert(success);
+        slassert("aaa" == el.get_val());
+    });
+    slassert(queue.put("ccc", 1000));
+    consumer.join();
+    my_movable_str el{""};
+    slassert(queue.poll(el));
+    slassert("bbb" == el.get_val());
+    slassert(queue.poll(el));
+    slassert("ccc" == el.get_val());
+}
+
+void test_put_multi() {
+    sc::blocking_queue<int> queue{4};
+    std::vector<std::thread> producers;
+    for (int i = 0; i < 4; i++) {
+        producers.emplace_back([&queue] {
+            for (size_t j = 0; j < ELEMENTS_COUNT; j++) {
+                bool success = queue.put(42);
+                slassert(success);
+            }
+        });
+    }
+    size_t count = 0;
+    while (count < ELEMENTS_COUNT * 4) {
+        int el = 0;
+        if (0 == count % 3) {
+            count += queue.consume([](int val) {
+                slassert(42 == val);
+            });
+        } else if (queue.take(el)) {
+            slassert(42 == el);
+            count += 1;
+        }
+    }
+    for (auto& th : producers) {
+        th.join();
+    }
+    slassert(queue.is_empty());
+}
+
+void test_put_unblock() {
+    sc::blocking_queue<my_movable_str> queue{1};
+    slassert(queue.put("aaa"));
+    std::thread producer([&queue] {
+        bool success = queue.put("bbb");
+        slassert(!success);
+    });
+    // ensure lock
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    queue.unblock();
+    producer.join();
+    slassert(1 == queue.size());
+}
+
+void test_take_n() {
+    sc::blocking_queue<my_movable_str> queue{};
+    std::vector<my_movable_str> vec;
+    // not yet available
+    slassert(0 == queue.take_n(vec, 8, 100));
+    std::thread producer([&queue] {
+        std::this_thread::sleep_for(std::chrono::milliseconds{100});
+        queue.emplace("aaa");
+        queue.emplace("bbb");
+        queue.emplace("ccc");
+        queue.emplace("ddd");
+    });
+    // wait for the first element
+    size_t received = 0;
+    while (received < 4) {
+        received += queue.take_n(vec, 2);
+    }
+    producer.join();
+    slassert(4 == vec.size());
+    slassert("aaa" == vec[0].get_val());
+    slassert("ddd" == vec[3].get_val());
+    slassert(queue.is_empty());
+    slassert(0 == queue.take_n(vec, 0, 0));
+}
+
+void test_drain_to() {
+    sc::blocking_queue<int> queue{4};
+    slassert(0 == queue.drain_to([](int) {
+        slassert(false);
+    }));
+    for (int i = 0; i < 4; i++) {
+        slassert(queue.emplace(i));
+    }
+    std::vector<int> vec;
+    size_t count = queue.drain_to([&queue, &vec](int el) {
+        // lock is not held
+        slassert(queue.is_empty());
+        vec.push_back(el);
+    });
+    slassert(4 == count);
+    slassert(4 == vec.size());
+    slassert(3 == vec[3]);
+    slassert(queue.emplace(4));
+}
+
+// can be constructed from the storage allocator
+struct constructible_from_any {
+    int value = 42;
+
+    constructible_from_any() { }
+
+    template<typename A>
+    constructible_from_any(const A&) :
+    value(-1) { }
+};
+
+void test_drain_to_any() {
+    sc::blocking_queue<constructible_from_any> queue{};
+    for (int i = 0; i < 3; i++) {
+        slassert(queue.emplace());
+    }
+    size_t count = queue.drain_to([](constructible_from_any el) {
+        slassert(42 == el.value);
+    });
+    slassert(3 == count);
+    // no element was made from the allocator
+    slassert(queue.is_empty());
+    slassert(0 == queue.drain_to([](constructible_from_any) {
+        slassert(false);
+    }));
+}
+
+size_t allocations_count = 0;
+
+template<typename T>
+struct counting_allocator {
+    typedef T value_type;
+
+    counting_allocator() { }
+
+    template<typename U>
+    counting_allocator(const counting_allocator<U>&) { }
+
+    T* allocate(size_t n) {
+        allocations_count += 1;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* ptr, size_t n) {
+        std::allocator<T>().deallocate(ptr, n);
+    }
+
+    template<typename U>
+    bool operator==(const counting_allocator<U>&) const {
+        return true;
+    }
+
+    template<typename U>
+    bool operator!=(const counting_allocator<U>&) const {
+        return false;
+    }
+};
+
+void test_ring_buffer_storage() {
+    typedef sc::ring_buffer<my_movable_str, counting_allocator<my_movable_str>> storage_type;
+    allocations_count = 0;
+    sc::blocking_queue<my_movable_str, storage_type> queue{4};
+    slassert(1 == allocations_count);
+    // bounded queue never touches the heap after creation
+    std::thread producer([&queue] {
+        for (size_t i = 0; i < ELEMENTS_COUNT; i++) {
+            bool success = queue.put(to_string(i));
+            slassert(success);
+        }
+    });
+    for (size_t i = 0; i < ELEMENTS_COUNT; i++) {
+        my_movable_str el{""};
+        bool success = queue.take(el);
+        slassert(success);
+        slassert(to_string(i) == el.get_val());
+    }
+    producer.join();
+    slassert(1 == allocations_count);
+    // storage with allocator
+    sc::blocking_queue<int, sc::ring_buffer<int>> unbounded{0, sc::ring_buffer<int>(std::allocator<int>())};
+    for (int i = 0; i < 100; i++) {
+        slassert(unbounded.emplace(i));
+    }
+    int sum = 0;
+    slassert(100 == unbounded.drain_to([&sum](int el) { sum += el; }));
+    slassert(4950 == sum);
+    slassert(unbounded.is_empty());
+}
+
+void test_no_lost_wakeups() {
+    // consumers park on the empty queue between producer bursts, lost
+    // wakeup would leave an element in the queue with consumers asleep
+    const size_t consumers_count = 32;
+    const size_t per_consumer = 64;
+    const size_t producers_count = 4;
+    const size_t per_producer = consumers_count * per_consumer / producers_count;
+    sc::blocking_queue<size_t> queue{};
+    std::atomic<size_t> sum{0};
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < consumers_count; i++) {
+        threads.emplace_back([&] {
+            for (size_t j = 0; j < per_consumer; j++) {
+                size_t el = 0;
+                bool success = queue.take(el, 10000);
+                slassert(success);
+                sum.fetch_add(el);
+            }
+        });
+    }
+    for (size_t i = 0; i < producers_count; i++) {
+        threads.emplace_back([&queue, i, per_producer] {
+            size_t emplaced = 0;
+            while (emplaced < per_producer) {
+                size_t burst = std::min<size_t>(1 + (emplaced + i) % 8, per_producer - emplaced);
+                if (0 == emplaced % 2) {
+                    for (size_t j = 0; j < burst; j++) {
+                        queue.emplace(1);
+                    }
+                } else {
+                    std::vector<size_t> vec(burst, 1);
+                    slassert(burst == queue.emplace_range(std::move(vec)));
+                }
+                emplaced += burst;
+                std::this_thread::sleep_for(std::chrono::microseconds{200});
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    slassert(consumers_count * per_consumer == sum.load());
+    slassert(queue.is_empty());
+}
+
+void test_emplace_range_count() {
+    sc::blocking_queue<std::string> queue{3};
+    slassert(2 == queue.emplace_range(std::vector<std::string>{"foo", "bar"}));
+    std::vector<std::string> vec{"baz", "42"};
+    slassert(1 == queue.emplace_range(vec));
+    slassert(0 == queue.emplace_range(std::vector<std::string>{"43"}));
+    slassert(3 == queue.size());
+}
+
+void test_stats() {
+    sc::blocking_queue<int, std::deque<int>, sc::queue_stats> queue{3};
+    slassert(queue.emplace(1));
+    slassert(2 == queue.emplace_range(std::vector<int>{2, 3}));
+    slassert(!queue.emplace(4));
+    slassert(!queue.put(5, 0));
+    int el = 0;
+    slassert(queue.poll(el));
+    slassert(queue.take(el));
+    std::vector<int> vec;
+    slassert(1 == queue.take_n(vec, 2));
+    std::thread producer([&queue] {
+        std::this_thread::sleep_for(std::chrono::milliseconds{50});
+        queue.emplace(6);
+    });
+    slassert(queue.take(el));
+    producer.join();
+    auto snap = queue.stats().snapshot();
+    slassert(4 == snap.enqueued);
+    slassert(4 == snap.dequeued);
+    slassert(2 == snap.rejected);
+    slassert(3 == snap.high_water_mark);
+    slassert(snap.wait_nanos > 0);
+    // default policy is compiled out
+    sc::blocking_queue<int> plain{};
+    slassert(plain.emplace(1));
+    slassert(0 == plain.stats().snapshot().enqueued);
+}
+
+void test_deadline() {
+    sc::blocking_queue<int> queue{1};
+    int el = 0;
+    // repeated waits against the same deadline do not extend it
+    auto start = std::chrono::steady_clock::now();
+    auto deadline = start + std::chrono::milliseconds{100};
+    while (queue.take_until(el, deadline)) { }
+    slassert(!queue.take_until(el, deadline));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    slassert(elapsed >= std::chrono::milliseconds{100});
+    slassert(elapsed < std::chrono::milliseconds{1000});
+    // expired deadline
+    slassert(!queue.take_until(el, start));
+    slassert(!queue.take_for(el, std::chrono::microseconds{500}));
+    std::vector<int> vec;
+    slassert(0 == queue.take_n_for(vec, 2, std::chrono::microseconds{500}));
+    slassert(queue.put_for(42, std::chrono::microseconds{500}));
+    slassert(!queue.put_for(43, std::chrono::microseconds{500}));
+    slassert(!queue.put_until(43, std::chrono::steady_clock::now()));
+    slassert(1 == queue.take_n_until(vec, 2, std::chrono::steady_clock::now()));
+    slassert(42 == vec[0]);
+    std::thread producer([&queue] {
+        std::this_thread::sleep_for(std::chrono::milliseconds{50});
+        queue.emplace(44);
+    });
+    slassert(queue.take_for(el, std::chrono::seconds{10}));
+    slassert(44 == el);
+    producer.join();
+}
+
+void test_size_guess() {
+    sc::blocking_queue<int> queue{4};
+    slassert(queue.empty_guess());
+    slassert(0 == queue.size_guess());
+    slassert(queue.emplace(1));
+    slassert(2 == queue.emplace_range(std::vector<int>{2, 3}));
+    slassert(3 == queue.size_guess());
+    slassert(!queue.empty_guess());
+    int el = 0;
+    slassert(queue.poll(el));
+    slassert(queue.take(el));
+    slassert(1 == queue.size_guess());
+    slassert(1 == queue.consume([](int) {}));
+    slassert(queue.empty_guess());
+    slassert(queue.put(4));
+    slassert(1 == queue.drain_to([](int) {}));
+    slassert(queue.empty_guess());
+    slassert(queue.size() == queue.size_guess());
+}
+
+#ifdef __cpp_impl_coroutine
+struct detached_task {
+    struct promise_type {
+        detached_task get_return_object() {
+            return detached_task{};
+        }
+
+        std::suspend_never initial_suspend() noexcept {
+            return {};
+        }
+
+        std::suspend_never final_suspend() noexcept {
+            return {};
+        }
+
+        void return_void() { }
+
+        void unhandled_exception() {
+            std::terminate();
+        }
+    };
+};
+
+detached_task take_async(sc::blocking_queue<std::string>& queue, std::vector<std::string>& out, bool& done) {
+    std::string el;
+    while (co_await queue.async_take(el)) {
+        out.push_back(el);
+    }
+    done = true;
+}
+
+detached_task put_async(sc::blocking_queue<std::string>& queue, int count, int& put_count) {
+    for (int i = 0; i < count; i++) {
+        if (!co_await queue.async_put(std::to_string(i))) {
+            break;
+        }
+        put_count += 1;
+    }
+}
+
+void test_coroutines() {
+    // consumer suspends on empty queue
+    sc::blocking_queue<std::string> queue{2};
+    std::vector<std::string> out;
+    bool taken = false;
+    take_async(queue, out, taken);
+    slassert(out.empty());
+    slassert(queue.emplace("foo"));
+    slassert(1 == out.size());
+    slassert("foo" == out[0]);
+    slassert(queue.is_empty());
+    // values are handed over directly
+    int put_count = 0;
+    put_async(queue, 10, put_count);
+    slassert(10 == put_count);
+    slassert(11 == out.size());
+    slassert("9" == out.back());
+    // unblock cancels the waiting consumer
+    slassert(!taken);
+    queue.unblock();
+    slassert(taken);
+
+    // producer suspends on full queue
+    sc::blocking_queue<std::string> full{1};
+    put_count = 0;
+    put_async(full, 3, put_count);
+    slassert(1 == put_count);
+    std::string el;
+    slassert(full.poll(el));
+    slassert("0" == el);
+    slassert(2 == put_count);
+    slassert(full.take(el));
+    slassert("1" == el);
+    slassert(3 == put_count);
+    slassert(full.poll(el));
+    slassert("2" == el);
+    put_count = 0;
+    slassert(full.emplace("42"));
+    put_async(full, 3, put_count);
+    full.unblock();
+    slassert(0 == put_count);
+
+    // resumed on the producer thread
+    sc::blocking_queue<std::string> threaded{16};
+    std::vector<std::string> received;
+    bool finished = false;
+    take_async(threaded, received, finished);
+    std::thread producer([&threaded] {
+        for (int i = 0; i < 1000; i++) {
+            slassert(threaded.put(std::to_string(i)));
+        }
+        threaded.unblock();
+    });
+    producer.join();
+    slassert(finished);
+    slassert(1000 == received.size());
+    slassert("999" == received.back());
+}
+#else // __cpp_impl_coroutine
+void test_coroutines() { }
+#endif // __cpp_impl_coroutine
+
 int main() {
     try {
         test_take();
@@ -286,6 +729,19 @@ int main() {
         test_threshold();
         test_unblock();
         test_integral();
+        test_put_wait();
+        test_put_multi();
+        test_put_unblock();
+        test_take_n();
+        test_drain_to();
+        test_drain_to_any();
+        test_ring_buffer_storage();
+        test_no_lost_wakeups();
+        test_emplace_range_count();
+        test_stats();
+        test_deadline();
+        test_size_guess();
+        test_coroutines();
     } catch (const std::exception& e) {
         std::cout << e.what() << std::endl;
         return 1;
@@ -0,0 +1,128 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   broadcast_queue_test.cpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#include "staticlib/containers/broadcast_queue.hpp"
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+namespace sc = staticlib::containers;
+
+void test_broadcast() {
+    sc::broadcast_queue<std::string> queue{3, 2};
+    slassert(2 == queue.consumers_count());
+    slassert(3 == queue.max_size());
+    slassert(queue.is_empty(0));
+    slassert(queue.emplace("foo"));
+    slassert(queue.emplace("bar"));
+    slassert(queue.emplace("baz"));
+    // gated by both consumers
+    slassert(queue.is_full());
+    slassert(!queue.emplace("42"));
+    std::string el;
+    slassert(queue.poll(0, el));
+    slassert("foo" == el);
+    // second consumer has not read it yet
+    slassert(!queue.emplace("42"));
+    const std::string* ptr = queue.front_ptr(1);
+    slassert(nullptr != ptr);
+    slassert("foo" == *ptr);
+    queue.pop_front(1);
+    slassert(queue.emplace("42"));
+    slassert(3 == queue.size_guess(0));
+    std::vector<std::string> vec;
+    slassert(3 == queue.consume(0, [&vec](const std::string& st) {
+        vec.push_back(st);
+    }));
+    slassert((std::vector<std::string>{"bar", "baz", "42"}) == vec);
+    slassert(queue.is_empty(0));
+    slassert(3 == queue.size_guess(1));
+    slassert(!queue.emplace("43"));
+}
+
+void test_destroy() {
+    auto counter = std::make_shared<int>(0);
+    {
+        sc::broadcast_queue<std::shared_ptr<int>> queue{4, 1};
+        for (int i = 0; i < 10; i++) {
+            slassert(queue.emplace(counter));
+            std::shared_ptr<int> el;
+            slassert(queue.poll(0, el));
+        }
+        // slots are reused, not more than ring size is kept
+        slassert(counter.use_count() <= 5);
+        slassert(queue.emplace(counter));
+    }
+    slassert(1 == counter.use_count());
+}
+
+void test_threads() {
+    const int consumers_count = 3;
+    const uint64_t count = 200000;
+    sc::broadcast_queue<uint64_t> queue{64, consumers_count};
+    std::vector<std::thread> consumers;
+    std::vector<uint64_t> sums(consumers_count, 0);
+    for (int i = 0; i < consumers_count; i++) {
+        consumers.emplace_back([&queue, &sums, i, count] {
+            uint64_t expected = 0;
+            while (expected < count) {
+                size_t consumed = queue.consume(i, [&expected, &sums, i](const uint64_t& el) {
+                    slassert(expected == el);
+                    expected += 1;
+                    sums[i] += el;
+                });
+                if (0 == consumed) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (uint64_t i = 0; i < count; i++) {
+        while (!queue.emplace(i)) {
+            std::this_thread::yield();
+        }
+    }
+    for (auto& th : consumers) {
+        th.join();
+    }
+    for (auto sum : sums) {
+        slassert(count * (count - 1) / 2 == sum);
+    }
+}
+
+int main() {
+    try {
+        test_broadcast();
+        test_destroy();
+        test_threads();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
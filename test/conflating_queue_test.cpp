@@ -0,0 +1,140 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   conflating_queue_test.cpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#include "staticlib/containers/conflating_queue.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+namespace sc = staticlib::containers;
+
+typedef sc::conflating_queue<std::string, int> quotes_queue;
+
+void test_conflate() {
+    quotes_queue queue;
+    slassert(queue.is_empty());
+    slassert(queue.emplace("foo", 1));
+    slassert(queue.emplace("bar", 2));
+    slassert(queue.emplace("foo", 3));
+    slassert(queue.emplace("baz", 4));
+    slassert(queue.emplace("bar", 5));
+    slassert(3 == queue.size());
+    slassert(2 == queue.conflated_count());
+    // latest values in the first insertion order
+    quotes_queue::value_type el;
+    slassert(queue.poll(el));
+    slassert("foo" == el.first);
+    slassert(3 == el.second);
+    slassert(queue.take(el));
+    slassert("bar" == el.first);
+    slassert(5 == el.second);
+    // key taken from the queue goes to the end
+    slassert(queue.emplace("foo", 6));
+    std::vector<quotes_queue::value_type> vec;
+    slassert(2 == queue.consume([&vec](quotes_queue::value_type&& en) {
+        vec.push_back(std::move(en));
+    }));
+    slassert("baz" == vec[0].first);
+    slassert("foo" == vec[1].first);
+    slassert(6 == vec[1].second);
+    slassert(queue.is_empty());
+    slassert(!queue.poll(el));
+}
+
+void test_bounded() {
+    quotes_queue queue{2};
+    slassert(queue.emplace("foo", 1));
+    slassert(queue.emplace("bar", 2));
+    slassert(queue.is_full());
+    // new key is rejected, existing keys are updated
+    slassert(!queue.emplace("baz", 3));
+    slassert(queue.emplace("foo", 4));
+    quotes_queue::value_type el;
+    slassert(queue.poll(el));
+    slassert(4 == el.second);
+    slassert(queue.emplace("baz", 3));
+}
+
+void test_take_wait() {
+    quotes_queue queue;
+    quotes_queue::value_type el;
+    slassert(!queue.take(el, 50));
+    std::thread producer([&queue] {
+        std::this_thread::sleep_for(std::chrono::milliseconds{50});
+        queue.emplace("foo", 42);
+    });
+    slassert(queue.take(el));
+    slassert(42 == el.second);
+    producer.join();
+    std::thread unblocker([&queue] {
+        std::this_thread::sleep_for(std::chrono::milliseconds{50});
+        queue.unblock();
+    });
+    slassert(!queue.take(el));
+    unblocker.join();
+    slassert(!queue.is_blocking());
+}
+
+void test_slow_consumer() {
+    const int keys_count = 16;
+    const int updates = 100000;
+    sc::conflating_queue<int, int> queue{keys_count};
+    std::thread producer([&queue, keys_count, updates] {
+        for (int i = 0; i < updates; i++) {
+            slassert(queue.emplace(i % keys_count, i));
+        }
+        queue.unblock();
+    });
+    std::vector<int> latest(keys_count, -1);
+    std::pair<int, int> el;
+    while (queue.take(el)) {
+        // values for the key only go forward
+        slassert(el.second > latest[el.first]);
+        latest[el.first] = el.second;
+    }
+    producer.join();
+    while (queue.poll(el)) {
+        latest[el.first] = el.second;
+    }
+    for (int i = 0; i < keys_count; i++) {
+        slassert(updates - keys_count + i == latest[i]);
+    }
+}
+
+int main() {
+    try {
+        test_conflate();
+        test_bounded();
+        test_take_wait();
+        test_slow_consumer();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   delay_queue_test.cpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#include "staticlib/containers/delay_queue.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+namespace sc = staticlib::containers;
+
+void test_order() {
+    sc::delay_queue<std::string> queue{};
+    auto now = std::chrono::steady_clock::now();
+    queue.emplace_at(now - std::chrono::milliseconds(10), "bar");
+    queue.emplace_at(now - std::chrono::milliseconds(20), "foo");
+    queue.emplace_at(now - std::chrono::milliseconds(10), "baz");
+    queue.emplace_after(std::chrono::hours(1), "42");
+    slassert(4 == queue.size());
+    sc::delay_queue<std::string>::time_point deadline;
+    slassert(queue.next_deadline(deadline));
+    slassert(now - std::chrono::milliseconds(20) == deadline);
+    std::string el;
+    slassert(queue.poll(el));
+    slassert("foo" == el);
+    // equal deadlines in insertion order
+    slassert(queue.take(el, 0));
+    slassert("bar" == el);
+    std::vector<std::string> vec;
+    size_t count = queue.consume([&vec](std::string st) {
+        vec.emplace_back(std::move(st));
+    });
+    slassert(1 == count);
+    slassert("baz" == vec[0]);
+    // pending element is not available
+    slassert(!queue.poll(el));
+    slassert(!queue.take(el, 10));
+    slassert(!queue.is_empty());
+}
+
+void test_wait() {
+    sc::delay_queue<int> queue{};
+    auto start = std::chrono::steady_clock::now();
+    queue.emplace_after(std::chrono::milliseconds(50), 42);
+    int el = 0;
+    slassert(queue.take(el));
+    slassert(42 == el);
+    slassert(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(50));
+    slassert(queue.is_empty());
+}
+
+void test_earlier() {
+    sc::delay_queue<int> queue{};
+    queue.emplace_after(std::chrono::hours(1), 1);
+    std::atomic<int> taken{0};
+    std::thread consumer([&queue, &taken] {
+        int el = 0;
+        if (queue.take(el)) {
+            taken.store(el);
+        }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    // consumer waits on the hour-long deadline
+    queue.emplace_after(std::chrono::milliseconds(10), 2);
+    consumer.join();
+    slassert(2 == taken.load());
+    slassert(1 == queue.size());
+}
+
+void test_threads() {
+    sc::delay_queue<int> queue{};
+    const int count = 100;
+    std::atomic<int> sum{0};
+    std::vector<std::thread> consumers;
+    for (int i = 0; i < 3; i++) {
+        consumers.emplace_back([&queue, &sum] {
+            int el = 0;
+            while (queue.take(el)) {
+                sum += el;
+            }
+        });
+    }
+    for (int i = 0; i < count; i++) {
+        queue.emplace_after(std::chrono::milliseconds(i % 10), i);
+    }
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!queue.is_empty() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    queue.unblock();
+    for (auto& th : consumers) {
+        th.join();
+    }
+    slassert(!queue.is_blocking());
+    slassert(count * (count - 1) / 2 == sum.load());
+}
+
+int main() {
+    try {
+        test_order();
+        test_wait();
+        test_earlier();
+        test_threads();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,240 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   mpmc_queue_test.cpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#include "staticlib/containers/mpmc_queue.hpp"
+
+#include <iostream>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+namespace sc = staticlib::containers;
+
+const uint32_t ELEMENTS_COUNT = 1 << 10;
+
+struct dtor_checker {
+    static int instances;
+
+    dtor_checker() {
+        ++instances;
+    }
+
+    dtor_checker(bool fail) {
+        if (fail) {
+            throw std::runtime_error("construction failed");
+        }
+        ++instances;
+    }
+
+    dtor_checker(const dtor_checker&) {
+        ++instances;
+    }
+
+    dtor_checker& operator=(const dtor_checker&) {
+        return *this;
+    }
+
+    ~dtor_checker() {
+        --instances;
+    }
+};
+
+int dtor_checker::instances = 0;
+
+void test_single() {
+    sc::mpmc_queue<std::string> queue{3};
+    slassert(4 == queue.max_size());
+    slassert(queue.is_empty());
+    slassert(queue.emplace("foo"));
+    slassert(queue.emplace(std::string("bar")));
+    slassert(queue.emplace(3, 'a'));
+    slassert(queue.emplace("baz"));
+    slassert(queue.is_full());
+    slassert(!queue.emplace("fail"));
+    slassert(4 == queue.size());
+    std::string el;
+    slassert(queue.poll(el));
+    slassert("foo" == el);
+    slassert(queue.poll(el));
+    slassert("bar" == el);
+    slassert(queue.poll(el));
+    slassert("aaa" == el);
+    slassert(queue.poll(el));
+    slassert("baz" == el);
+    slassert(!queue.poll(el));
+    slassert(queue.is_empty());
+}
+
+void test_range() {
+    sc::mpmc_queue<int> queue{4};
+    std::vector<int> vec{1, 2, 3, 4, 5};
+    slassert(4 == queue.emplace_range(vec));
+    slassert(5 == vec.size());
+    int sum = 0;
+    slassert(4 == queue.consume([&sum](int el) { sum += el; }));
+    slassert(10 == sum);
+    slassert(2 == queue.emplace_range(std::vector<int>{6, 7}));
+    slassert(2 == queue.size());
+}
+
+void test_destructor() {
+    {
+        sc::mpmc_queue<dtor_checker> queue{8};
+        for (int i = 0; i < 5; i++) {
+            slassert(queue.emplace());
+        }
+        slassert(5 == dtor_checker::instances);
+        dtor_checker ignore;
+        slassert(queue.poll(ignore));
+        slassert(5 == dtor_checker::instances);
+    }
+    slassert(0 == dtor_checker::instances);
+}
+
+void test_throwing_constructor() {
+    sc::mpmc_queue<dtor_checker> queue{4};
+    slassert(queue.emplace(false));
+    bool thrown = false;
+    try {
+        queue.emplace(true);
+    } catch (const std::exception&) {
+        thrown = true;
+    }
+    slassert(thrown);
+    slassert(queue.emplace(false));
+    slassert(2 == dtor_checker::instances);
+    dtor_checker el;
+    slassert(queue.poll(el));
+    slassert(queue.poll(el));
+    slassert(!queue.poll(el));
+    slassert(1 == dtor_checker::instances);
+}
+
+class throwing_assign {
+public:
+    static int instances;
+    bool fail;
+
+    explicit throwing_assign(bool fail = false) :
+    fail(fail) {
+        instances += 1;
+    }
+
+    throwing_assign(throwing_assign&& other) :
+    fail(other.fail) {
+        instances += 1;
+    }
+
+    throwing_assign& operator=(throwing_assign&& other) {
+        if (other.fail) {
+            throw std::runtime_error("throwing_assign");
+        }
+        this->fail = other.fail;
+        return *this;
+    }
+
+    ~throwing_assign() {
+        instances -= 1;
+    }
+};
+
+int throwing_assign::instances = 0;
+
+void test_throwing_assignment() {
+    sc::mpmc_queue<throwing_assign> queue{2};
+    slassert(queue.emplace(true));
+    throwing_assign el;
+    bool thrown = false;
+    try {
+        queue.poll(el);
+    } catch (const std::exception&) {
+        thrown = true;
+    }
+    slassert(thrown);
+    // element is destroyed and the cell is released
+    slassert(1 == throwing_assign::instances);
+    slassert(!queue.poll(el));
+    for (int i = 0; i < 8; i++) {
+        slassert(queue.emplace(false));
+        slassert(queue.emplace(false));
+        slassert(!queue.emplace(false));
+        slassert(queue.poll(el));
+        slassert(queue.poll(el));
+    }
+    slassert(1 == throwing_assign::instances);
+}
+
+void test_multi() {
+    sc::mpmc_queue<uint64_t> queue{64};
+    const size_t producers = 4;
+    const size_t consumers = 4;
+    std::atomic<uint64_t> sum{0};
+    std::atomic<size_t> taken{0};
+    std::vector<std::thread> threads;
+    for (size_t p = 0; p < producers; p++) {
+        threads.emplace_back([&queue] {
+            for (uint64_t i = 1; i <= ELEMENTS_COUNT; i++) {
+                while (!queue.emplace(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (size_t c = 0; c < consumers; c++) {
+        threads.emplace_back([&] {
+            while (taken.load() < producers * ELEMENTS_COUNT) {
+                uint64_t el = 0;
+                if (queue.poll(el)) {
+                    sum.fetch_add(el);
+                    taken.fetch_add(1);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    slassert(producers * ELEMENTS_COUNT * (ELEMENTS_COUNT + 1) / 2 == sum.load());
+    slassert(queue.is_empty());
+}
+
+int main() {
+    try {
+        test_single();
+        test_range();
+        test_destructor();
+        test_throwing_constructor();
+        test_throwing_assignment();
+        test_multi();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
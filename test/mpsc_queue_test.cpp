@@ -0,0 +1,200 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   mpsc_queue_test.cpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#include "staticlib/containers/mpsc_queue.hpp"
+
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+namespace sc = staticlib::containers;
+
+struct message : sc::mpsc_hook {
+    int producer;
+    int seq;
+
+    message(int producer, int seq) :
+    producer(producer),
+    seq(seq) { }
+};
+
+void test_intrusive() {
+    sc::intrusive_mpsc_queue<message> queue;
+    slassert(queue.is_empty());
+    slassert(nullptr == queue.pop());
+    message m1{0, 1};
+    message m2{0, 2};
+    message m3{0, 3};
+    queue.push(&m1);
+    queue.push(&m2);
+    slassert(!queue.is_empty());
+    slassert(&m1 == queue.pop());
+    queue.push(&m3);
+    // m1 can be reused after pop
+    queue.push(&m1);
+    slassert(&m2 == queue.pop());
+    slassert(&m3 == queue.pop());
+    slassert(&m1 == queue.pop());
+    slassert(nullptr == queue.pop());
+    queue.push(&m1);
+    queue.push(&m2);
+    queue.push(&m3);
+    std::vector<int> seqs;
+    slassert(3 == queue.consume([&seqs](message* msg) {
+        seqs.push_back(msg->seq);
+    }));
+    slassert((std::vector<int>{1, 2, 3}) == seqs);
+    slassert(queue.is_empty());
+}
+
+void test_pooled() {
+    sc::mpsc_queue<std::string> queue{2};
+    slassert(queue.is_empty());
+    // beyond the pool size
+    for (int i = 0; i < 5; i++) {
+        queue.emplace(std::to_string(i));
+    }
+    std::string el;
+    slassert(queue.poll(el));
+    slassert("0" == el);
+    std::vector<std::string> vec;
+    slassert(4 == queue.consume([&vec](std::string&& st) {
+        vec.push_back(std::move(st));
+    }));
+    slassert("4" == vec.back());
+    slassert(!queue.poll(el));
+    // left in queue are destroyed
+    queue.emplace("foo");
+    queue.emplace("bar");
+}
+
+void test_consume_throw() {
+    sc::mpsc_queue<int> queue{4};
+    for (int i = 0; i < 4; i++) {
+        queue.emplace(i);
+    }
+    bool thrown = false;
+    try {
+        queue.consume([](int el) {
+            if (1 == el) {
+                throw std::runtime_error("test");
+            }
+        });
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    slassert(thrown);
+    int el = -1;
+    slassert(queue.poll(el));
+    slassert(2 == el);
+    slassert(queue.poll(el));
+    slassert(3 == el);
+    slassert(queue.is_empty());
+}
+
+void test_intrusive_threads() {
+    const int producers_count = 4;
+    const int per_producer = 50000;
+    sc::intrusive_mpsc_queue<message> queue;
+    std::vector<std::unique_ptr<message>> messages;
+    for (int i = 0; i < producers_count; i++) {
+        for (int j = 0; j < per_producer; j++) {
+            messages.emplace_back(new message(i, j));
+        }
+    }
+    std::vector<std::thread> producers;
+    for (int i = 0; i < producers_count; i++) {
+        producers.emplace_back([&queue, &messages, i] {
+            for (int j = 0; j < per_producer; j++) {
+                queue.push(messages[i * per_producer + j].get());
+            }
+        });
+    }
+    std::vector<int> expected(producers_count, 0);
+    int received = 0;
+    while (received < producers_count * per_producer) {
+        size_t count = queue.consume([&expected](message* msg) {
+            // FIFO for each producer
+            slassert(expected[msg->producer] == msg->seq);
+            expected[msg->producer] += 1;
+        });
+        if (0 == count) {
+            std::this_thread::yield();
+        }
+        received += static_cast<int>(count);
+    }
+    for (auto& th : producers) {
+        th.join();
+    }
+    slassert(queue.is_empty());
+}
+
+void test_pooled_threads() {
+    const int producers_count = 4;
+    const int per_producer = 50000;
+    sc::mpsc_queue<std::pair<int, int>> queue{64};
+    std::vector<std::thread> producers;
+    for (int i = 0; i < producers_count; i++) {
+        producers.emplace_back([&queue, i] {
+            for (int j = 0; j < per_producer; j++) {
+                queue.emplace(i, j);
+            }
+        });
+    }
+    std::vector<int> expected(producers_count, 0);
+    int received = 0;
+    std::pair<int, int> el;
+    while (received < producers_count * per_producer) {
+        if (queue.poll(el)) {
+            slassert(expected[el.first] == el.second);
+            expected[el.first] += 1;
+            received += 1;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    for (auto& th : producers) {
+        th.join();
+    }
+    slassert(queue.is_empty());
+}
+
+int main() {
+    try {
+        test_intrusive();
+        test_pooled();
+        test_consume_throw();
+        test_intrusive_threads();
+        test_pooled_threads();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
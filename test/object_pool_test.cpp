@@ -0,0 +1,159 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   object_pool_test.cpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#include "staticlib/containers/object_pool.hpp"
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "staticlib/containers/blocking_queue.hpp"
+#include "staticlib/containers/producer_consumer_queue.hpp"
+
+#include "staticlib/config/assert.hpp"
+
+namespace sc = staticlib::containers;
+
+typedef sc::object_pool<std::string> string_pool;
+
+void test_acquire() {
+    string_pool pool{4, 2};
+    slassert(2 == pool.size_guess());
+    slassert(2 == pool.allocations_count());
+    std::string* first = nullptr;
+    {
+        auto st = pool.acquire();
+        first = st.get();
+        st->assign(100, 'a');
+        slassert(1 == pool.size_guess());
+    }
+    slassert(2 == pool.size_guess());
+    std::vector<string_pool::pooled_ptr> vec;
+    for (int i = 0; i < 8; i++) {
+        vec.emplace_back(pool.acquire());
+    }
+    slassert(8 == pool.allocations_count());
+    slassert(0 == pool.size_guess());
+    // capacity is kept, contents are not cleared
+    bool found = false;
+    for (auto& st : vec) {
+        if (first == st.get()) {
+            found = true;
+            slassert(100 == st->size());
+        }
+    }
+    slassert(found);
+    // free list is bounded, excess objects are deleted
+    vec.clear();
+    slassert(4 == pool.size_guess());
+}
+
+void test_local_cache() {
+    string_pool pool{64};
+    {
+        string_pool::local_cache cache{pool, 4};
+        std::vector<string_pool::pooled_ptr> vec;
+        for (int i = 0; i < 10; i++) {
+            vec.emplace_back(cache.acquire());
+        }
+        slassert(10 == pool.allocations_count());
+        for (auto& st : vec) {
+            cache.release(std::move(st));
+        }
+        // excess returned to the shared free list in batches
+        slassert(cache.size() < 8);
+        slassert(10 == cache.size() + pool.size_guess());
+        for (int i = 0; i < 10; i++) {
+            vec[i] = cache.acquire();
+        }
+        slassert(10 == pool.allocations_count());
+    }
+    slassert(10 == pool.size_guess());
+}
+
+void test_producer_consumer_return_path() {
+    const size_t capacity = 16;
+    const int count = 100000;
+    string_pool pool{64};
+    sc::producer_consumer_queue<string_pool::pooled_ptr> queue{capacity};
+    std::thread producer([&pool, &queue, count] {
+        for (int i = 0; i < count; i++) {
+            auto st = pool.acquire();
+            st->assign(std::to_string(i));
+            while (!queue.emplace(std::move(st))) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    string_pool::pooled_ptr st;
+    int received = 0;
+    while (received < count) {
+        if (queue.poll(st)) {
+            slassert(std::to_string(received) == *st);
+            // returned to the pool on the consumer thread
+            st.reset();
+            received += 1;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    // steady state does not allocate
+    slassert(pool.allocations_count() <= capacity + 2);
+}
+
+void test_blocking_queue_return_path() {
+    const int count = 10000;
+    string_pool pool{64};
+    sc::blocking_queue<string_pool::pooled_ptr> queue{8};
+    std::thread producer([&pool, &queue, count] {
+        string_pool::local_cache cache{pool, 4};
+        for (int i = 0; i < count; i++) {
+            auto st = cache.acquire();
+            st->assign(std::to_string(i));
+            slassert(queue.put(std::move(st)));
+        }
+    });
+    string_pool::pooled_ptr st;
+    for (int i = 0; i < count; i++) {
+        slassert(queue.take(st));
+        slassert(std::to_string(i) == *st);
+        st.reset();
+    }
+    producer.join();
+    slassert(pool.allocations_count() <= 32);
+}
+
+int main() {
+    try {
+        test_acquire();
+        test_local_cache();
+        test_producer_consumer_return_path();
+        test_blocking_queue_return_path();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
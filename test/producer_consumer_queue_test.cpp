@@ -25,8 +25,12 @@
 
 #include "staticlib/containers/producer_consumer_queue.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <thread>
@@ -252,12 +256,369 @@ void test_EmptyFull() {
     slassert(queue.size_guess() == 3);
 }
 
+void test_CachedIndices() {
+    // producer and consumer reload the other side's index
+    // only when the queue looks full or empty
+    sc::producer_consumer_queue<int> queue(2);
+    slassert(queue.emplace(1));
+    slassert(queue.emplace(2));
+    slassert(!queue.emplace(3));
+    int taken = 0;
+    slassert(queue.poll(taken));
+    slassert(1 == taken);
+    slassert(queue.emplace(3));
+    slassert(!queue.emplace(4));
+    slassert(queue.poll(taken));
+    slassert(2 == taken);
+    slassert(queue.poll(taken));
+    slassert(3 == taken);
+    slassert(!queue.poll(taken));
+    slassert(nullptr == queue.front_ptr());
+    slassert(queue.emplace(4));
+    slassert(nullptr != queue.front_ptr());
+    slassert(4 == *queue.front_ptr());
+    slassert(queue.size_guess() == 1);
+}
+
+void test_EmplaceRange() {
+    sc::producer_consumer_queue<std::string> queue(4);
+    std::vector<std::string> vec{"foo", "bar", "baz"};
+    slassert(3 == queue.emplace_range(vec));
+    slassert(3 == vec.size());
+    slassert("foo" == vec[0]);
+    slassert(1 == queue.emplace_range(std::vector<std::string>{"42", "43"}));
+    slassert(queue.is_full());
+    slassert(0 == queue.emplace_range(vec));
+    std::string taken;
+    slassert(queue.poll(taken));
+    slassert("foo" == taken);
+    slassert(queue.poll(taken));
+    slassert("bar" == taken);
+    slassert(queue.poll(taken));
+    slassert("baz" == taken);
+    slassert(queue.poll(taken));
+    slassert("42" == taken);
+    slassert(!queue.poll(taken));
+}
+
+void test_PollN() {
+    sc::producer_consumer_queue<std::string> queue(4);
+    for (int i = 0; i < 3; i++) {
+        slassert(queue.emplace(std::string(1, '0' + i)));
+    }
+    std::vector<std::string> vec;
+    slassert(2 == queue.poll_n(std::back_inserter(vec), 2));
+    slassert(2 == vec.size());
+    slassert("0" == vec[0]);
+    slassert("1" == vec[1]);
+    // wrap
+    for (int i = 3; i < 6; i++) {
+        slassert(queue.emplace(std::string(1, '0' + i)));
+    }
+    std::string arr[8];
+    slassert(4 == queue.poll_n(arr, 8));
+    slassert("2" == arr[0]);
+    slassert("5" == arr[3]);
+    slassert(0 == queue.poll_n(arr, 8));
+    slassert(queue.is_empty());
+}
+
+void test_Consume() {
+    sc::producer_consumer_queue<int> queue(4);
+    slassert(0 == queue.consume([](int) { slassert(false); }));
+    for (int i = 0; i < 4; i++) {
+        slassert(queue.emplace(i));
+    }
+    std::vector<int> vec;
+    slassert(4 == queue.consume([&vec](int el) { vec.push_back(el); }));
+    slassert(4 == vec.size());
+    slassert(0 == vec[0]);
+    slassert(3 == vec[3]);
+    slassert(queue.is_empty());
+}
+
+void test_BatchThreads() {
+    const int count = 1 << 16;
+    sc::producer_consumer_queue<int> queue(256);
+    std::thread producer([&queue, count] {
+        std::vector<int> batch;
+        int next = 0;
+        while (next < count) {
+            batch.clear();
+            for (int i = next; i < count && batch.size() < 32; i++) {
+                batch.push_back(i);
+            }
+            size_t emplaced = 0;
+            while (emplaced < batch.size()) {
+                std::vector<int> rest(batch.begin() + emplaced, batch.end());
+                emplaced += queue.emplace_range(rest);
+            }
+            next += static_cast<int>(batch.size());
+        }
+    });
+    int expected = 0;
+    std::vector<int> vec;
+    while (expected < count) {
+        vec.clear();
+        queue.poll_n(std::back_inserter(vec), 64);
+        for (int el : vec) {
+            slassert(expected == el);
+            expected += 1;
+        }
+    }
+    producer.join();
+    slassert(queue.is_empty());
+}
+
+void test_Stats() {
+    sc::producer_consumer_queue<int, sc::queue_stats> queue{4};
+    slassert(queue.emplace(1));
+    slassert(3 == queue.emplace_range(std::vector<int>{2, 3, 4, 5}));
+    slassert(!queue.emplace(6));
+    int el = 0;
+    slassert(queue.poll(el));
+    std::vector<int> vec;
+    slassert(2 == queue.poll_n(std::back_inserter(vec), 2));
+    auto snap = queue.stats().snapshot();
+    slassert(4 == snap.enqueued);
+    slassert(3 == snap.dequeued);
+    slassert(2 == snap.rejected);
+    slassert(4 == snap.high_water_mark);
+    slassert(0 == snap.wait_nanos);
+}
+
+struct Packet {
+    uint32_t len;
+    char data[60];
+};
+
+void test_ReserveCommit() {
+    sc::producer_consumer_queue<Packet> queue{2};
+    Packet* slot = queue.reserve();
+    slassert(nullptr != slot);
+    // not published before commit
+    slassert(queue.is_empty());
+    slassert(slot == queue.reserve());
+    slot->len = 3;
+    std::memcpy(slot->data, "foo", 3);
+    queue.commit();
+    slassert(1 == queue.size_guess());
+    Packet* second = queue.reserve();
+    slassert(nullptr != second);
+    second->len = 0;
+    queue.commit();
+    slassert(nullptr == queue.reserve());
+    Packet* front = queue.front_ptr();
+    slassert(slot == front);
+    slassert(3 == front->len);
+    slassert(0 == std::memcmp(front->data, "foo", 3));
+    slassert(queue.pop_front());
+    slassert(!queue.is_full());
+    slassert(nullptr != queue.reserve());
+}
+
+void test_PopFront() {
+    sc::producer_consumer_queue<std::string> queue{4};
+    slassert(!queue.pop_front());
+    new (queue.reserve()) std::string("foo");
+    queue.commit();
+    slassert(queue.emplace("bar"));
+    slassert("foo" == *queue.front_ptr());
+    slassert(queue.pop_front());
+    slassert("bar" == *queue.front_ptr());
+    slassert(queue.pop_front());
+    slassert(!queue.pop_front());
+    slassert(nullptr == queue.front_ptr());
+    slassert(queue.is_empty());
+}
+
+void test_InPlaceThreads() {
+    sc::producer_consumer_queue<Packet> queue{16};
+    const uint32_t count = 100000;
+    std::thread producer([&queue, count] {
+        for (uint32_t i = 0; i < count; i++) {
+            Packet* slot = nullptr;
+            while (nullptr == (slot = queue.reserve())) {
+                std::this_thread::yield();
+            }
+            slot->len = i;
+            queue.commit();
+        }
+    });
+    for (uint32_t expected = 0; expected < count;) {
+        Packet* front = queue.front_ptr();
+        if (nullptr == front) {
+            std::this_thread::yield();
+            continue;
+        }
+        slassert(expected == front->len);
+        slassert(queue.pop_front());
+        expected += 1;
+    }
+    producer.join();
+    slassert(queue.is_empty());
+}
+
+void test_MaskIndexing() {
+    // capacity is kept exact for non power-of-two sizes
+    sc::producer_consumer_queue<int> queue{3};
+    slassert(3 == queue.max_size());
+    for (int round = 0; round < 100; round++) {
+        for (int i = 0; i < 3; i++) {
+            slassert(queue.emplace(round + i));
+            slassert(static_cast<size_t>(i + 1) == queue.size_guess());
+        }
+        slassert(queue.is_full());
+        slassert(!queue.emplace(-1));
+        int el = -1;
+        slassert(queue.poll(el));
+        slassert(round == el);
+        slassert(2 == queue.size_guess());
+        slassert(!queue.is_full());
+        std::vector<int> vec;
+        slassert(2 == queue.poll_n(std::back_inserter(vec), 3));
+        slassert(round + 2 == vec.back());
+        slassert(queue.is_empty());
+        slassert(0 == queue.size_guess());
+    }
+    sc::producer_consumer_queue<int> single{1};
+    slassert(single.emplace(1));
+    slassert(single.is_full());
+    slassert(!single.emplace(2));
+}
+
+void test_StaticCapacity() {
+    typedef sc::static_producer_consumer_queue<std::string, 3> queue_type;
+    std::unique_ptr<queue_type> queue{new queue_type()};
+    slassert(3 == queue->max_size());
+    for (int round = 0; round < 10; round++) {
+        slassert(queue->emplace("foo"));
+        slassert(queue->emplace("bar"));
+        slassert(queue->emplace("baz"));
+        slassert(queue->is_full());
+        slassert(!queue->emplace("42"));
+        std::string el;
+        slassert(queue->poll(el));
+        slassert("foo" == el);
+        slassert(queue->emplace("43"));
+        std::vector<std::string> vec;
+        slassert(3 == queue->poll_n(std::back_inserter(vec), 4));
+        slassert("43" == vec.back());
+    }
+    // elements left in queue are destroyed
+    slassert(queue->emplace("foo"));
+    queue.reset();
+    // no heap allocation for the storage
+    sc::static_producer_consumer_queue<int, 16> local;
+    slassert(sizeof(local) >= sizeof(int) * 16);
+    slassert(local.emplace(42));
+    slassert(42 == *local.front_ptr());
+}
+
+void test_Allocation() {
+    // cache line aligned by default
+    sc::producer_consumer_queue<char> def{100};
+    slassert(def.emplace('a'));
+    slassert(0 == reinterpret_cast<uintptr_t>(def.front_ptr()) % 64);
+
+    sc::ring_allocation page_aligned;
+    page_aligned.alignment = 4096;
+    sc::producer_consumer_queue<int> aligned{100, page_aligned};
+    slassert(aligned.emplace(42));
+    slassert(0 == reinterpret_cast<uintptr_t>(aligned.front_ptr()) % 4096);
+
+    // hints, fall back to regular pages when huge pages are not available
+    sc::ring_allocation huge;
+    huge.huge_pages = true;
+    huge.numa_node = 0;
+    huge.prefault = true;
+    sc::producer_consumer_queue<std::string> mapped{1 << 16, huge};
+    slassert(0 == reinterpret_cast<uintptr_t>(mapped.reserve()) % 4096);
+    for (int round = 0; round < 3; round++) {
+        for (int i = 0; i < (1 << 16); i++) {
+            slassert(mapped.emplace(std::to_string(i)));
+        }
+        slassert(mapped.is_full());
+        std::string el;
+        for (int i = 0; i < (1 << 16); i++) {
+            slassert(mapped.poll(el));
+            slassert(std::to_string(i) == el);
+        }
+    }
+    slassert(mapped.emplace("foo"));
+}
+
+struct tick {
+    uint64_t seq;
+    uint64_t instrument;
+    double price;
+    double volume;
+};
+
+void test_TrivialSpans() {
+    sc::producer_consumer_queue<tick> queue{10};
+    std::vector<tick> in;
+    for (uint64_t i = 0; i < 100; i++) {
+        in.push_back(tick{i, i % 7, 1.5 * i, 2.0});
+    }
+    uint64_t written = 0;
+    uint64_t read = 0;
+    std::vector<tick> out(16);
+    // spans wrap around the end of the storage
+    while (read < in.size()) {
+        size_t to_write = (std::min)(static_cast<size_t>(in.size() - written), static_cast<size_t>(7));
+        written += queue.emplace_n(in.data() + written, to_write);
+        slassert(queue.size_guess() <= 10);
+        size_t count = queue.poll_n(out.data(), 3);
+        for (size_t i = 0; i < count; i++) {
+            slassert(read == out[i].seq);
+            slassert(1.5 * read == out[i].price);
+            read += 1;
+        }
+    }
+    slassert(queue.is_empty());
+    // partial write on full queue
+    slassert(10 == queue.emplace_n(in.data(), 15));
+    slassert(0 == queue.emplace_n(in.data(), 1));
+    slassert(10 == queue.poll_n(out.data(), 16));
+    slassert(9 == out[9].seq);
+    slassert(0 == queue.poll_n(out.data(), 16));
+}
+
+void test_NonTrivialSpans() {
+    sc::producer_consumer_queue<std::string> queue{5};
+    std::vector<std::string> in{"foo", "bar", "baz", "42", "43", "44"};
+    slassert(5 == queue.emplace_n(in.data(), in.size()));
+    // copied, not moved
+    slassert("foo" == in[0]);
+    std::vector<std::string> out(3);
+    slassert(3 == queue.poll_n(out.data(), 3));
+    slassert("baz" == out[2]);
+    slassert(1 == queue.emplace_n(in.data() + 5, 1));
+    slassert(3 == queue.poll_n(out.data(), 3));
+    slassert("44" == out[2]);
+}
+
 int main() {
     try {
         test_QueueCorrectness();
         test_PerfTest();
         test_Destructor();
         test_EmptyFull();
+        test_CachedIndices();
+        test_EmplaceRange();
+        test_PollN();
+        test_Consume();
+        test_BatchThreads();
+        test_Stats();
+        test_ReserveCommit();
+        test_PopFront();
+        test_InPlaceThreads();
+        test_MaskIndexing();
+        test_StaticCapacity();
+        test_Allocation();
+        test_TrivialSpans();
+        test_NonTrivialSpans();
     } catch (const std::exception& e) {
         std::cout << e.what() << std::endl;
         return 1;
@@ -0,0 +1,166 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   queue_selector_test.cpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#include "staticlib/containers/queue_selector.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "staticlib/containers/blocking_queue.hpp"
+
+#include "staticlib/config/assert.hpp"
+
+namespace sc = staticlib::containers;
+
+void test_wait_any() {
+    sc::queue_selector selector;
+    sc::blocking_queue<std::string> control;
+    sc::blocking_queue<int> data;
+    control.set_selector(&selector);
+    data.set_selector(&selector);
+    slassert(-1 == selector.wait_any(0, control, data));
+    slassert(-1 == selector.wait_any(50, control, data));
+    slassert(data.emplace(42));
+    slassert(1 == selector.wait_any(-1, control, data));
+    // first queue has priority
+    slassert(control.emplace("stop"));
+    slassert(0 == selector.wait_any(-1, control, data));
+    std::string cmd;
+    slassert(control.poll(cmd));
+    slassert(1 == selector.wait_any(-1, control, data));
+    int el = 0;
+    slassert(data.poll(el));
+    slassert(42 == el);
+    selector.unblock();
+    slassert(!selector.is_blocking());
+    slassert(-1 == selector.wait_any(-1, control, data));
+}
+
+void test_dispatcher() {
+    const int queues_count = 4;
+    const int per_queue = 10000;
+    sc::queue_selector selector;
+    sc::blocking_queue<std::string> control;
+    control.set_selector(&selector);
+    std::vector<std::unique_ptr<sc::blocking_queue<int>>> data;
+    std::vector<sc::blocking_queue<int>*> data_ptrs;
+    for (int i = 0; i < queues_count; i++) {
+        data.emplace_back(new sc::blocking_queue<int>(16));
+        data.back()->set_selector(&selector);
+        data_ptrs.push_back(data.back().get());
+    }
+    std::vector<std::thread> producers;
+    for (int i = 0; i < queues_count; i++) {
+        producers.emplace_back([&data, i] {
+            for (int j = 0; j < per_queue; j++) {
+                slassert(data[i]->put(j));
+            }
+        });
+    }
+    std::thread controller([&control, &producers] {
+        for (auto& th : producers) {
+            th.join();
+        }
+        control.emplace("stop");
+    });
+    std::vector<int> expected(queues_count, 0);
+    auto poll_data = [&expected, &data_ptrs](int idx) {
+        int el = -1;
+        if (data_ptrs[idx]->poll(el)) {
+            slassert(expected[idx] == el);
+            expected[idx] += 1;
+        }
+    };
+    std::string cmd;
+    for (;;) {
+        int idx = selector.wait_any(-1, control, *data[0], *data[1], *data[2], *data[3]);
+        if (0 == idx) {
+            slassert(control.poll(cmd));
+            break;
+        }
+        poll_data(idx - 1);
+    }
+    // stop is sent after all data was added
+    for (;;) {
+        int idx = selector.wait_any_of(data_ptrs, 0);
+        if (-1 == idx) {
+            break;
+        }
+        poll_data(idx);
+    }
+    controller.join();
+    for (int count : expected) {
+        slassert(per_queue == count);
+    }
+}
+
+void test_multiplex() {
+    const int per_queue = 20000;
+    sc::queue_selector selector;
+    sc::blocking_queue<int> first{8};
+    sc::blocking_queue<int> second{8};
+    first.set_selector(&selector);
+    second.set_selector(&selector);
+    std::thread producer([&first, &second] {
+        for (int i = 0; i < per_queue; i++) {
+            slassert(first.put(i));
+            slassert(second.put(i));
+        }
+    });
+    int received_first = 0;
+    int received_second = 0;
+    while (received_first + received_second < 2 * per_queue) {
+        int el = -1;
+        switch (selector.wait_any(1000, first, second)) {
+        case 0:
+            slassert(first.poll(el));
+            slassert(received_first == el);
+            received_first += 1;
+            break;
+        case 1:
+            slassert(second.poll(el));
+            slassert(received_second == el);
+            received_second += 1;
+            break;
+        default:
+            slassert(false);
+        }
+    }
+    producer.join();
+}
+
+int main() {
+    try {
+        test_wait_any();
+        test_dispatcher();
+        test_multiplex();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
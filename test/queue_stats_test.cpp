@@ -0,0 +1,69 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   queue_stats_test.cpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#include "staticlib/containers/queue_stats.hpp"
+
+#include <iostream>
+
+#include "staticlib/config/assert.hpp"
+
+namespace sc = staticlib::containers;
+
+void test_counters() {
+    sc::queue_stats stats;
+    stats.on_enqueue(3, 3);
+    stats.on_enqueue(1, 2);
+    stats.on_reject();
+    stats.on_dequeue(2);
+    stats.on_wait(42);
+    stats.on_contention();
+    auto snap = stats.snapshot();
+    slassert(4 == snap.enqueued);
+    slassert(2 == snap.dequeued);
+    slassert(1 == snap.rejected);
+    slassert(3 == snap.high_water_mark);
+    slassert(42 == snap.wait_nanos);
+    slassert(1 == snap.contended);
+}
+
+void test_disabled() {
+    sc::no_queue_stats stats;
+    stats.on_enqueue(3, 3);
+    stats.on_reject();
+    auto snap = stats.snapshot();
+    slassert(0 == snap.enqueued);
+    slassert(0 == snap.rejected);
+    slassert(!sc::no_queue_stats::enabled);
+    slassert(sc::queue_stats::enabled);
+}
+
+int main() {
+    try {
+        test_counters();
+        test_disabled();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
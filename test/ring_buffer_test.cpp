@@ -0,0 +1,145 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   ring_buffer_test.cpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#include "staticlib/containers/ring_buffer.hpp"
+
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "staticlib/config/assert.hpp"
+
+namespace sc = staticlib::containers;
+
+size_t allocations_count = 0;
+
+template<typename T>
+struct counting_allocator {
+    typedef T value_type;
+
+    counting_allocator() { }
+
+    template<typename U>
+    counting_allocator(const counting_allocator<U>&) { }
+
+    T* allocate(size_t n) {
+        allocations_count += 1;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* ptr, size_t n) {
+        std::allocator<T>().deallocate(ptr, n);
+    }
+
+    template<typename U>
+    bool operator==(const counting_allocator<U>&) const {
+        return true;
+    }
+
+    template<typename U>
+    bool operator!=(const counting_allocator<U>&) const {
+        return false;
+    }
+};
+
+void test_fifo() {
+    sc::ring_buffer<std::string> buf;
+    slassert(buf.empty());
+    slassert(0 == buf.capacity());
+    for (size_t i = 0; i < 100; i++) {
+        buf.emplace_back(std::string(1, 'a' + (i % 26)));
+    }
+    slassert(100 == buf.size());
+    for (size_t i = 0; i < 100; i++) {
+        slassert(std::string(1, 'a' + (i % 26)) == buf.front());
+        buf.pop_front();
+    }
+    slassert(buf.empty());
+}
+
+void test_wrap_and_grow() {
+    sc::ring_buffer<int> buf;
+    buf.reserve(4);
+    slassert(4 == buf.capacity());
+    buf.emplace_back(1);
+    buf.emplace_back(2);
+    buf.emplace_back(3);
+    buf.pop_front();
+    buf.pop_front();
+    // wraps
+    buf.emplace_back(4);
+    buf.emplace_back(5);
+    buf.emplace_back(6);
+    slassert(4 == buf.size());
+    slassert(4 == buf.capacity());
+    slassert(3 == buf.front());
+    slassert(6 == buf.back());
+    // grows with wrapped contents
+    buf.emplace_back(7);
+    slassert(8 == buf.capacity());
+    for (int i = 3; i <= 7; i++) {
+        slassert(i == buf[i - 3]);
+    }
+    for (int i = 3; i <= 7; i++) {
+        slassert(i == buf.front());
+        buf.pop_front();
+    }
+    slassert(buf.empty());
+}
+
+void test_allocations() {
+    allocations_count = 0;
+    {
+        sc::ring_buffer<std::string, counting_allocator<std::string>> buf;
+        buf.reserve(8);
+        slassert(1 == allocations_count);
+        for (size_t i = 0; i < 1000; i++) {
+            buf.emplace_back("foo");
+            buf.emplace_back("bar");
+            buf.pop_front();
+            buf.pop_front();
+        }
+        slassert(1 == allocations_count);
+        sc::ring_buffer<std::string, counting_allocator<std::string>> other;
+        other.emplace_back("baz");
+        buf.swap(other);
+        slassert(1 == buf.size());
+        slassert("baz" == buf.front());
+        slassert(other.empty());
+        other = std::move(buf);
+        slassert(1 == other.size());
+        slassert(buf.empty());
+    }
+}
+
+int main() {
+    try {
+        test_fifo();
+        test_wrap_and_grow();
+        test_allocations();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
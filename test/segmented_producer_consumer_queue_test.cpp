@@ -0,0 +1,123 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   segmented_producer_consumer_queue_test.cpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#include "staticlib/containers/segmented_producer_consumer_queue.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "staticlib/config/assert.hpp"
+
+namespace sc = staticlib::containers;
+
+void test_segments() {
+    sc::segmented_producer_consumer_queue<std::string> queue{2};
+    slassert(2 == queue.segment_size());
+    slassert(queue.is_empty());
+    std::string el;
+    slassert(!queue.poll(el));
+    // spans 3 segments
+    queue.emplace("foo");
+    queue.emplace("bar");
+    queue.emplace("baz");
+    queue.emplace("42");
+    queue.emplace("43");
+    slassert(!queue.is_empty());
+    slassert(queue.poll(el));
+    slassert("foo" == el);
+    slassert(queue.poll(el));
+    slassert("bar" == el);
+    std::string* ptr = queue.front_ptr();
+    slassert(nullptr != ptr);
+    slassert("baz" == *ptr);
+    slassert(queue.pop_front());
+    size_t count = queue.consume([](std::string st) {
+        slassert("42" == st || "43" == st);
+    });
+    slassert(2 == count);
+    slassert(queue.is_empty());
+    slassert(!queue.poll(el));
+    // reused segments
+    for (int i = 0; i < 10; i++) {
+        queue.emplace(std::to_string(i));
+    }
+    for (int i = 0; i < 10; i++) {
+        slassert(queue.poll(el));
+        slassert(std::to_string(i) == el);
+    }
+    slassert(queue.is_empty());
+}
+
+void test_destroy() {
+    auto tracker = std::make_shared<int>(42);
+    {
+        sc::segmented_producer_consumer_queue<std::shared_ptr<int>> queue{4, 1};
+        for (int i = 0; i < 15; i++) {
+            queue.emplace(tracker);
+        }
+        std::shared_ptr<int> el;
+        for (int i = 0; i < 6; i++) {
+            slassert(queue.poll(el));
+        }
+        el.reset();
+        slassert(10 == tracker.use_count());
+    }
+    slassert(1 == tracker.use_count());
+}
+
+void test_threads() {
+    const uint64_t count = 1 << 18;
+    sc::segmented_producer_consumer_queue<uint64_t> queue{64};
+    std::thread consumer([&queue, count] {
+        uint64_t expected = 0;
+        while (expected < count) {
+            uint64_t el = 0;
+            if (queue.poll(el)) {
+                slassert(expected == el);
+                expected += 1;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+    for (uint64_t i = 0; i < count; i++) {
+        queue.emplace(i);
+    }
+    consumer.join();
+    slassert(queue.is_empty());
+}
+
+int main() {
+    try {
+        test_segments();
+        test_destroy();
+        test_threads();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
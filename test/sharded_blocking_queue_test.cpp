@@ -0,0 +1,191 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   sharded_blocking_queue_test.cpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#include "staticlib/containers/sharded_blocking_queue.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+namespace sc = staticlib::containers;
+
+void test_lanes() {
+    sc::sharded_blocking_queue<std::string> queue{4, 0, sc::lane_selection::round_robin};
+    slassert(4 == queue.lanes_count());
+    slassert(queue.is_empty());
+    for (int i = 0; i < 8; i++) {
+        slassert(queue.emplace(std::to_string(i)));
+    }
+    slassert(8 == queue.size_guess());
+    std::string el;
+    slassert(queue.poll(el));
+    slassert(queue.take(el, 0));
+    std::vector<std::string> rest;
+    slassert(6 == queue.consume([&rest](std::string&& el) {
+        rest.push_back(std::move(el));
+    }));
+    slassert(queue.is_empty());
+    slassert(!queue.poll(el));
+}
+
+void test_bounded() {
+    sc::sharded_blocking_queue<int> queue{2, 2};
+    // lane of this thread becomes full, then the other one is used
+    for (int i = 0; i < 4; i++) {
+        slassert(queue.emplace(i));
+    }
+    slassert(!queue.emplace(4));
+    int el = -1;
+    slassert(queue.poll(el));
+    slassert(queue.emplace(4));
+}
+
+void test_lane_fifo() {
+    // single producer thread with affinity uses a single lane
+    sc::sharded_blocking_queue<int> queue{4};
+    for (int i = 0; i < 100; i++) {
+        slassert(queue.emplace(i));
+    }
+    int el = -1;
+    for (int i = 0; i < 100; i++) {
+        slassert(queue.poll(el));
+        slassert(i == el);
+    }
+}
+
+class no_default {
+    int val;
+
+public:
+    explicit no_default(int val) :
+    val(val) { }
+
+    int get_val() const {
+        return val;
+    }
+};
+
+void test_emplace_args() {
+    sc::sharded_blocking_queue<std::pair<int, std::string>> queue{2, 1};
+    slassert(queue.emplace(1, "foo"));
+    slassert(queue.emplace(2, "bar"));
+    slassert(!queue.emplace(3, "baz"));
+    std::pair<int, std::string> el;
+    slassert(queue.poll(el));
+    slassert(queue.emplace(3, "baz"));
+    slassert(2 == queue.size_guess());
+}
+
+void test_consume_no_default() {
+    sc::sharded_blocking_queue<no_default> queue{4, 0, sc::lane_selection::round_robin};
+    for (int i = 0; i < 8; i++) {
+        slassert(queue.emplace(i));
+    }
+    int sum = 0;
+    slassert(8 == queue.consume([&sum](no_default&& el) {
+        sum += el.get_val();
+    }));
+    slassert(28 == sum);
+    slassert(queue.is_empty());
+    slassert(0 == queue.size_guess());
+    slassert(0 == queue.consume([](no_default&&) {
+        slassert(false);
+    }));
+}
+
+void test_take_wait() {
+    sc::sharded_blocking_queue<int> queue{2};
+    int el = -1;
+    auto start = std::chrono::steady_clock::now();
+    slassert(!queue.take(el, 100));
+    slassert(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds{100});
+    std::thread producer([&queue] {
+        std::this_thread::sleep_for(std::chrono::milliseconds{50});
+        queue.emplace(42);
+    });
+    slassert(queue.take(el));
+    slassert(42 == el);
+    producer.join();
+}
+
+void test_multi() {
+    const int producers_count = 8;
+    const int consumers_count = 3;
+    const int per_producer = 20000;
+    sc::sharded_blocking_queue<int> queue{4};
+    std::atomic<long> sum{0};
+    std::atomic<int> received{0};
+    std::vector<std::thread> consumers;
+    for (int i = 0; i < consumers_count; i++) {
+        consumers.emplace_back([&queue, &sum, &received] {
+            int el = -1;
+            while (queue.take(el)) {
+                sum.fetch_add(el);
+                received.fetch_add(1);
+            }
+        });
+    }
+    std::vector<std::thread> producers;
+    for (int i = 0; i < producers_count; i++) {
+        producers.emplace_back([&queue] {
+            for (int j = 0; j < per_producer; j++) {
+                queue.emplace(j);
+            }
+        });
+    }
+    for (auto& th : producers) {
+        th.join();
+    }
+    while (received.load() < producers_count * per_producer) {
+        std::this_thread::yield();
+    }
+    queue.unblock();
+    for (auto& th : consumers) {
+        th.join();
+    }
+    long expected = static_cast<long>(per_producer) * (per_producer - 1) / 2 * producers_count;
+    slassert(expected == sum.load());
+    slassert(!queue.is_blocking());
+}
+
+int main() {
+    try {
+        test_lanes();
+        test_bounded();
+        test_lane_fifo();
+        test_emplace_args();
+        test_consume_no_default();
+        test_take_wait();
+        test_multi();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
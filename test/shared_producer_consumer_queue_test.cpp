@@ -0,0 +1,207 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   shared_producer_consumer_queue_test.cpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#include "staticlib/containers/shared_producer_consumer_queue.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif // !_WIN32
+
+#include "staticlib/config/assert.hpp"
+
+namespace sc = staticlib::containers;
+
+struct message {
+    uint64_t seq;
+    char payload[24];
+};
+
+typedef sc::shared_producer_consumer_queue<message> queue_type;
+
+void test_create_attach() {
+    std::vector<uint64_t> buf(queue_type::required_size(3) / sizeof(uint64_t) + 1);
+    auto producer = queue_type::create(buf.data(), buf.size() * sizeof(uint64_t), 3);
+    auto consumer = queue_type::attach(buf.data(), buf.size() * sizeof(uint64_t));
+    slassert(3 == consumer.max_size());
+    slassert(consumer.is_empty());
+    message msg;
+    msg.seq = 1;
+    std::strcpy(msg.payload, "foo");
+    slassert(producer.emplace(msg));
+    message* slot = producer.reserve();
+    slassert(nullptr != slot);
+    slot->seq = 2;
+    std::strcpy(slot->payload, "bar");
+    producer.commit();
+    msg.seq = 3;
+    slassert(producer.emplace(msg));
+    slassert(producer.is_full());
+    slassert(!producer.emplace(msg));
+    slassert(3 == consumer.size_guess());
+    message res;
+    slassert(consumer.poll(res));
+    slassert(1 == res.seq);
+    slassert(0 == std::strcmp("foo", res.payload));
+    const message* front = consumer.front_ptr();
+    slassert(nullptr != front);
+    slassert(2 == front->seq);
+    slassert(0 == std::strcmp("bar", front->payload));
+    slassert(consumer.pop_front());
+    std::vector<message> vec;
+    slassert(1 == consumer.poll_n(std::back_inserter(vec), 4));
+    slassert(3 == vec[0].seq);
+    slassert(!consumer.poll(res));
+    slassert(!consumer.pop_front());
+    // reattach keeps the indices
+    slassert(producer.emplace(msg));
+    auto reattached = queue_type::attach(buf.data(), buf.size() * sizeof(uint64_t));
+    slassert(1 == reattached.size_guess());
+    slassert(reattached.poll(res));
+}
+
+void test_attach_errors() {
+    std::vector<uint64_t> buf(queue_type::required_size(4) / sizeof(uint64_t) + 1);
+    size_t size = buf.size() * sizeof(uint64_t);
+    bool thrown = false;
+    try {
+        queue_type::attach(buf.data(), size);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    slassert(thrown);
+    thrown = false;
+    try {
+        queue_type::create(buf.data(), queue_type::required_size(4) - 1, 4);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    slassert(thrown);
+    queue_type::create(buf.data(), size, 4);
+    thrown = false;
+    try {
+        // different element size
+        sc::shared_producer_consumer_queue<uint32_t>::attach(buf.data(), size);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    slassert(thrown);
+    thrown = false;
+    try {
+        queue_type::attach(buf.data(), queue_type::required_size(4) - 1);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    slassert(thrown);
+}
+
+void test_threads() {
+    const uint64_t count = 100000;
+    std::vector<uint64_t> buf(queue_type::required_size(64) / sizeof(uint64_t) + 1);
+    size_t size = buf.size() * sizeof(uint64_t);
+    auto producer = queue_type::create(buf.data(), size, 64);
+    std::thread th([&buf, size, count] {
+        auto consumer = queue_type::attach(buf.data(), size);
+        uint64_t expected = 0;
+        message msg;
+        while (expected < count) {
+            if (consumer.poll(msg)) {
+                slassert(expected == msg.seq);
+                expected += 1;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+    message msg;
+    std::memset(&msg, 0, sizeof(msg));
+    for (uint64_t i = 0; i < count; i++) {
+        msg.seq = i;
+        while (!producer.emplace(msg)) {
+            std::this_thread::yield();
+        }
+    }
+    th.join();
+    slassert(producer.is_empty());
+}
+
+void test_processes() {
+#ifndef _WIN32
+    const uint64_t count = 10000;
+    size_t size = queue_type::required_size(16);
+    void* buf = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    slassert(MAP_FAILED != buf);
+    queue_type::create(buf, size, 16);
+    pid_t pid = fork();
+    slassert(pid >= 0);
+    if (0 == pid) {
+        auto producer = queue_type::attach(buf, size);
+        message msg;
+        std::memset(&msg, 0, sizeof(msg));
+        for (uint64_t i = 0; i < count; i++) {
+            msg.seq = i;
+            while (!producer.emplace(msg)) {
+                sched_yield();
+            }
+        }
+        _exit(0);
+    }
+    auto consumer = queue_type::attach(buf, size);
+    uint64_t expected = 0;
+    message msg;
+    while (expected < count) {
+        if (consumer.poll(msg)) {
+            slassert(expected == msg.seq);
+            expected += 1;
+        } else {
+            sched_yield();
+        }
+    }
+    int status = -1;
+    slassert(pid == waitpid(pid, &status, 0));
+    slassert(0 == status);
+    munmap(buf, size);
+#endif // !_WIN32
+}
+
+int main() {
+    try {
+        test_create_attach();
+        test_attach_errors();
+        test_threads();
+        test_processes();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
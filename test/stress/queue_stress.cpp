@@ -0,0 +1,768 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   queue_stress.cpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+// Concurrency stress and contention profiling for the queues.
+// Each producer sends sequence-numbered payloads for the specified duration,
+// consumers check that every producer's sequence numbers arrive in increasing
+// order (for FIFO queues) and, after the run, that every payload was delivered
+// exactly once (to every consumer for "broadcast_queue"). Each run is repeated
+// with 1, 2, 4 ... N threads on each side, cycles spent in successful put
+// and take calls are reported per operation. Results are written as CSV,
+// exit code is non-zero on any violation.
+//
+// All concurrent queue types are covered, except the ones exercised through
+// other types: "work_stealing_deque" (workers of "work_stealing_queue"),
+// "intrusive_mpsc_queue" (base of "mpsc_queue") and "static_producer_consumer_queue"
+// ("producer_consumer_queue" with inline storage). "ring_buffer" is not
+// synchronized and "object_pool" is not a queue (its free list is "mpmc_queue").
+//
+// usage: queue_stress [--threads N] [--millis N] [--capacity N] [--filter NAME] [--output FILE]
+// defaults can be set with STRESS_THREADS, STRESS_MILLIS, STRESS_CAPACITY
+// and STRESS_FILTER environment variables
+
+#include "staticlib/containers/blocking_mpmc_queue.hpp"
+#include "staticlib/containers/blocking_priority_queue.hpp"
+#include "staticlib/containers/blocking_producer_consumer_queue.hpp"
+#include "staticlib/containers/blocking_queue.hpp"
+#include "staticlib/containers/broadcast_queue.hpp"
+#include "staticlib/containers/conflating_queue.hpp"
+#include "staticlib/containers/delay_queue.hpp"
+#include "staticlib/containers/mpmc_queue.hpp"
+#include "staticlib/containers/mpsc_queue.hpp"
+#include "staticlib/containers/producer_consumer_queue.hpp"
+#include "staticlib/containers/segmented_producer_consumer_queue.hpp"
+#include "staticlib/containers/sharded_blocking_queue.hpp"
+#include "staticlib/containers/shared_producer_consumer_queue.hpp"
+#include "staticlib/containers/work_stealing_queue.hpp"
+#include "staticlib/containers/detail/eventcount.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace sc = staticlib::containers;
+
+namespace { // anonymous
+
+struct payload {
+    uint32_t producer;
+    uint64_t seq;
+};
+
+struct config {
+    size_t threads = 4;
+    size_t millis = 1000;
+    size_t capacity = 1 << 10;
+    std::string filter;
+    std::string output;
+};
+
+// TSC on x86, nanoseconds elsewhere
+uint64_t cycles() {
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+#endif
+}
+
+// adapters, "put" and "take" may fail on full and empty queue
+
+struct pcq_adapter {
+    static const size_t max_producers = 1;
+    static const size_t max_consumers = 1;
+    static const bool fifo = true;
+    static const bool broadcast = false;
+    sc::producer_consumer_queue<payload> queue;
+
+    pcq_adapter(size_t capacity, size_t /* consumers */) :
+    queue(static_cast<uint32_t>(capacity)) { }
+
+    static const char* name() {
+        return "producer_consumer_queue";
+    }
+
+    bool put(const payload& pl) {
+        return queue.emplace(pl);
+    }
+
+    bool take(size_t /* idx */, payload& pl) {
+        return queue.poll(pl);
+    }
+};
+
+struct blocking_pcq_adapter {
+    static const size_t max_producers = 1;
+    static const size_t max_consumers = 1;
+    static const bool fifo = true;
+    static const bool broadcast = false;
+    sc::blocking_producer_consumer_queue<payload> queue;
+
+    blocking_pcq_adapter(size_t capacity, size_t /* consumers */) :
+    queue(static_cast<uint32_t>(capacity)) { }
+
+    static const char* name() {
+        return "blocking_producer_consumer_queue";
+    }
+
+    bool put(const payload& pl) {
+        return queue.put(pl, 1);
+    }
+
+    bool take(size_t /* idx */, payload& pl) {
+        return queue.take(pl, 1);
+    }
+};
+
+struct shared_pcq_adapter {
+    typedef sc::shared_producer_consumer_queue<payload> queue_type;
+    static const size_t max_producers = 1;
+    static const size_t max_consumers = 1;
+    static const bool fifo = true;
+    static const bool broadcast = false;
+    // uint64_t elements for the alignment of the header
+    std::vector<uint64_t> buffer;
+    queue_type producer;
+    queue_type consumer;
+
+    shared_pcq_adapter(size_t capacity, size_t /* consumers */) :
+    buffer(queue_type::required_size(static_cast<uint32_t>(capacity)) / sizeof(uint64_t) + 1),
+    producer(queue_type::create(buffer.data(), buffer.size() * sizeof(uint64_t), static_cast<uint32_t>(capacity))),
+    consumer(queue_type::attach(buffer.data(), buffer.size() * sizeof(uint64_t))) { }
+
+    static const char* name() {
+        return "shared_producer_consumer_queue";
+    }
+
+    bool put(const payload& pl) {
+        return producer.emplace(pl);
+    }
+
+    bool take(size_t /* idx */, payload& pl) {
+        return consumer.poll(pl);
+    }
+};
+
+struct segmented_pcq_adapter {
+    static const size_t max_producers = 1;
+    static const size_t max_consumers = 1;
+    static const bool fifo = true;
+    static const bool broadcast = false;
+    sc::segmented_producer_consumer_queue<payload> queue;
+
+    // small segments to exercise linking and reuse
+    segmented_pcq_adapter(size_t capacity, size_t /* consumers */) :
+    queue(static_cast<uint32_t>(std::max(capacity / 16, static_cast<size_t>(1)))) { }
+
+    static const char* name() {
+        return "segmented_producer_consumer_queue";
+    }
+
+    bool put(const payload& pl) {
+        queue.emplace(pl);
+        return true;
+    }
+
+    bool take(size_t /* idx */, payload& pl) {
+        return queue.poll(pl);
+    }
+};
+
+struct mpmc_adapter {
+    static const size_t max_producers = static_cast<size_t>(-1);
+    static const size_t max_consumers = static_cast<size_t>(-1);
+    static const bool fifo = true;
+    static const bool broadcast = false;
+    sc::mpmc_queue<payload> queue;
+
+    mpmc_adapter(size_t capacity, size_t /* consumers */) :
+    queue(capacity) { }
+
+    static const char* name() {
+        return "mpmc_queue";
+    }
+
+    bool put(const payload& pl) {
+        return queue.emplace(pl);
+    }
+
+    bool take(size_t /* idx */, payload& pl) {
+        return queue.poll(pl);
+    }
+};
+
+struct blocking_mpmc_adapter {
+    static const size_t max_producers = static_cast<size_t>(-1);
+    static const size_t max_consumers = static_cast<size_t>(-1);
+    static const bool fifo = true;
+    static const bool broadcast = false;
+    sc::blocking_mpmc_queue<payload> queue;
+
+    blocking_mpmc_adapter(size_t capacity, size_t /* consumers */) :
+    queue(capacity) { }
+
+    static const char* name() {
+        return "blocking_mpmc_queue";
+    }
+
+    bool put(const payload& pl) {
+        return queue.put(pl, 1);
+    }
+
+    bool take(size_t /* idx */, payload& pl) {
+        return queue.take(pl, 1);
+    }
+};
+
+struct mpsc_adapter {
+    static const size_t max_producers = static_cast<size_t>(-1);
+    static const size_t max_consumers = 1;
+    static const bool fifo = true;
+    static const bool broadcast = false;
+    sc::mpsc_queue<payload> queue;
+
+    mpsc_adapter(size_t capacity, size_t /* consumers */) :
+    queue(capacity) { }
+
+    static const char* name() {
+        return "mpsc_queue";
+    }
+
+    bool put(const payload& pl) {
+        queue.emplace(pl);
+        return true;
+    }
+
+    bool take(size_t /* idx */, payload& pl) {
+        return queue.poll(pl);
+    }
+};
+
+struct blocking_queue_adapter {
+    static const size_t max_producers = static_cast<size_t>(-1);
+    static const size_t max_consumers = static_cast<size_t>(-1);
+    static const bool fifo = true;
+    static const bool broadcast = false;
+    sc::blocking_queue<payload> queue;
+
+    blocking_queue_adapter(size_t capacity, size_t /* consumers */) :
+    queue(capacity) { }
+
+    static const char* name() {
+        return "blocking_queue";
+    }
+
+    bool put(const payload& pl) {
+        return queue.put(pl, 1);
+    }
+
+    bool take(size_t /* idx */, payload& pl) {
+        return queue.take(pl, 1);
+    }
+};
+
+struct sharded_adapter {
+    static const size_t max_producers = static_cast<size_t>(-1);
+    static const size_t max_consumers = static_cast<size_t>(-1);
+    // elements of one producer may be spread over lanes
+    static const bool fifo = false;
+    static const bool broadcast = false;
+    sc::sharded_blocking_queue<payload> queue;
+
+    sharded_adapter(size_t capacity, size_t /* consumers */) :
+    queue(4, std::max(capacity / 4, static_cast<size_t>(1))) { }
+
+    static const char* name() {
+        return "sharded_blocking_queue";
+    }
+
+    bool put(const payload& pl) {
+        return queue.emplace(pl);
+    }
+
+    bool take(size_t /* idx */, payload& pl) {
+        return queue.take(pl, 1);
+    }
+};
+
+// lower sequence numbers first
+struct payload_priority {
+    bool operator()(const payload& a, const payload& b) const {
+        return a.seq > b.seq;
+    }
+};
+
+struct blocking_priority_adapter {
+    static const size_t max_producers = static_cast<size_t>(-1);
+    static const size_t max_consumers = static_cast<size_t>(-1);
+    // priority order interleaves producers
+    static const bool fifo = false;
+    static const bool broadcast = false;
+    sc::blocking_priority_queue<payload, payload_priority> queue;
+
+    blocking_priority_adapter(size_t capacity, size_t /* consumers */) :
+    queue(capacity) { }
+
+    static const char* name() {
+        return "blocking_priority_queue";
+    }
+
+    bool put(const payload& pl) {
+        return queue.emplace(pl);
+    }
+
+    bool take(size_t /* idx */, payload& pl) {
+        return queue.take(pl, 1);
+    }
+};
+
+struct delay_adapter {
+    static const size_t max_producers = static_cast<size_t>(-1);
+    static const size_t max_consumers = static_cast<size_t>(-1);
+    // deadline order interleaves producers
+    static const bool fifo = false;
+    static const bool broadcast = false;
+    sc::delay_queue<payload> queue;
+
+    delay_adapter(size_t /* capacity */, size_t /* consumers */) { }
+
+    static const char* name() {
+        return "delay_queue";
+    }
+
+    bool put(const payload& pl) {
+        queue.emplace_after(std::chrono::milliseconds(0), pl);
+        return true;
+    }
+
+    bool take(size_t /* idx */, payload& pl) {
+        return queue.take(pl, 1);
+    }
+};
+
+struct conflating_adapter {
+    static const size_t max_producers = static_cast<size_t>(-1);
+    static const size_t max_consumers = static_cast<size_t>(-1);
+    // keys are distinct, nothing is conflated
+    static const bool fifo = true;
+    static const bool broadcast = false;
+    sc::conflating_queue<uint64_t, payload> queue;
+
+    conflating_adapter(size_t capacity, size_t /* consumers */) :
+    queue(capacity) { }
+
+    static const char* name() {
+        return "conflating_queue";
+    }
+
+    bool put(const payload& pl) {
+        uint64_t key = (static_cast<uint64_t>(pl.producer) << 40) | pl.seq;
+        return queue.emplace(key, pl);
+    }
+
+    bool take(size_t /* idx */, payload& pl) {
+        sc::conflating_queue<uint64_t, payload>::value_type en;
+        if (queue.take(en, 1)) {
+            pl = en.second;
+            return true;
+        }
+        return false;
+    }
+};
+
+struct work_stealing_adapter {
+    static const size_t max_producers = static_cast<size_t>(-1);
+    static const size_t max_consumers = static_cast<size_t>(-1);
+    // tasks are stolen from the other workers
+    static const bool fifo = false;
+    static const bool broadcast = false;
+    // packed into 8 bytes, deque slots are atomic
+    sc::work_stealing_queue<uint64_t> queue;
+
+    work_stealing_adapter(size_t /* capacity */, size_t consumers) :
+    queue(consumers) { }
+
+    static const char* name() {
+        return "work_stealing_queue";
+    }
+
+    bool put(const payload& pl) {
+        queue.submit((static_cast<uint64_t>(pl.producer) << 40) | pl.seq);
+        return true;
+    }
+
+    bool take(size_t idx, payload& pl) {
+        uint64_t task = 0;
+        if (queue.take(idx, task, 1)) {
+            pl.producer = static_cast<uint32_t>(task >> 40);
+            pl.seq = task & ((static_cast<uint64_t>(1) << 40) - 1);
+            return true;
+        }
+        return false;
+    }
+};
+
+struct broadcast_adapter {
+    static const size_t max_producers = 1;
+    static const size_t max_consumers = static_cast<size_t>(-1);
+    static const bool fifo = true;
+    // every consumer receives every payload
+    static const bool broadcast = true;
+    sc::broadcast_queue<payload> queue;
+
+    broadcast_adapter(size_t capacity, size_t consumers) :
+    queue(static_cast<uint32_t>(capacity), consumers) { }
+
+    static const char* name() {
+        return "broadcast_queue";
+    }
+
+    bool put(const payload& pl) {
+        return queue.emplace(pl);
+    }
+
+    bool take(size_t idx, payload& pl) {
+        return queue.poll(idx, pl);
+    }
+};
+
+struct producer_state {
+    uint64_t sent = 0;
+    uint64_t cycles = 0;
+    uint64_t failed = 0;
+};
+
+struct consumer_state {
+    std::vector<uint64_t> last_seq;
+    std::vector<uint64_t> counts;
+    std::vector<uint64_t> sums;
+    uint64_t received = 0;
+    uint64_t cycles = 0;
+    uint64_t failed = 0;
+    uint64_t violations = 0;
+
+    explicit consumer_state(size_t producers) :
+    last_seq(producers, 0),
+    counts(producers, 0),
+    sums(producers, 0) { }
+};
+
+struct result {
+    size_t producers = 0;
+    size_t consumers = 0;
+    double seconds = 0;
+    uint64_t ops = 0;
+    uint64_t put_cycles = 0;
+    uint64_t take_cycles = 0;
+    uint64_t put_failed = 0;
+    uint64_t take_failed = 0;
+    uint64_t violations = 0;
+};
+
+std::mutex report_mutex;
+
+void report_violation(const char* queue_name, const std::string& msg) {
+    std::lock_guard<std::mutex> guard{report_mutex};
+    std::cerr << "VIOLATION: " << queue_name << ": " << msg << std::endl;
+}
+
+template<typename Adapter>
+void produce(Adapter& queue, uint32_t idx, const std::atomic<bool>& stop, producer_state& st) {
+    // sequence numbers start from 1, 0 in "last_seq" means nothing received
+    uint64_t seq = 1;
+    while (!stop.load(std::memory_order_relaxed)) {
+        payload pl{idx, seq};
+        size_t spins = 0;
+        for (;;) {
+            uint64_t start = cycles();
+            bool success = queue.put(pl);
+            uint64_t spent = cycles() - start;
+            if (success) {
+                st.cycles += spent;
+                break;
+            }
+            st.failed += 1;
+            if (stop.load(std::memory_order_relaxed)) {
+                // not sent, is not expected by consumers
+                st.sent = seq - 1;
+                return;
+            }
+            spins += 1;
+            if (spins < 64) {
+                sc::detail::cpu_relax();
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        seq += 1;
+    }
+    st.sent = seq - 1;
+}
+
+template<typename Adapter>
+void consume(Adapter& queue, size_t idx, const std::atomic<bool>& done, const std::atomic<uint64_t>& expected,
+        std::atomic<uint64_t>& received, consumer_state& st) {
+    for (;;) {
+        payload pl;
+        uint64_t start = cycles();
+        bool success = queue.take(idx, pl);
+        uint64_t spent = cycles() - start;
+        if (!success) {
+            st.failed += 1;
+            // all producers are finished and everything is received,
+            // by this consumer in broadcast mode
+            uint64_t received_count = Adapter::broadcast ? st.received :
+                    received.load(std::memory_order_acquire);
+            if (done.load(std::memory_order_acquire) &&
+                    received_count >= expected.load(std::memory_order_relaxed)) {
+                return;
+            }
+            std::this_thread::yield();
+            continue;
+        }
+        st.cycles += spent;
+        st.received += 1;
+        received.fetch_add(1, std::memory_order_acq_rel);
+        if (pl.producer >= st.counts.size() || 0 == pl.seq) {
+            st.violations += 1;
+            report_violation(Adapter::name(), "corrupted payload, producer: " + std::to_string(pl.producer) +
+                    ", seq: " + std::to_string(pl.seq));
+            continue;
+        }
+        if (Adapter::fifo && pl.seq <= st.last_seq[pl.producer]) {
+            st.violations += 1;
+            report_violation(Adapter::name(), "out of order, producer: " + std::to_string(pl.producer) +
+                    ", seq: " + std::to_string(pl.seq) + " after: " + std::to_string(st.last_seq[pl.producer]));
+        }
+        st.last_seq[pl.producer] = pl.seq;
+        st.counts[pl.producer] += 1;
+        st.sums[pl.producer] += pl.seq;
+    }
+}
+
+template<typename Adapter>
+result run(const config& cfg, size_t producers_count, size_t consumers_count) {
+    Adapter queue(cfg.capacity, consumers_count);
+    std::atomic<bool> stop{false};
+    std::atomic<bool> done{false};
+    std::atomic<uint64_t> expected{0};
+    std::atomic<uint64_t> received{0};
+    std::vector<producer_state> producers(producers_count);
+    std::vector<consumer_state> consumers(consumers_count, consumer_state(producers_count));
+    std::vector<std::thread> producer_threads;
+    std::vector<std::thread> consumer_threads;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < consumers_count; i++) {
+        consumer_threads.emplace_back([&, i] {
+            consume(queue, i, done, expected, received, consumers[i]);
+        });
+    }
+    for (size_t i = 0; i < producers_count; i++) {
+        producer_threads.emplace_back([&, i] {
+            produce(queue, static_cast<uint32_t>(i), stop, producers[i]);
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(cfg.millis));
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& th : producer_threads) {
+        th.join();
+    }
+    uint64_t sent = 0;
+    for (auto& st : producers) {
+        sent += st.sent;
+    }
+    expected.store(sent, std::memory_order_relaxed);
+    done.store(true, std::memory_order_release);
+    for (auto& th : consumer_threads) {
+        th.join();
+    }
+    result res;
+    res.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    res.producers = producers_count;
+    res.consumers = consumers_count;
+    res.ops = sent;
+    for (auto& st : producers) {
+        res.put_cycles += st.cycles;
+        res.put_failed += st.failed;
+    }
+    for (auto& st : consumers) {
+        res.take_cycles += st.cycles;
+        res.take_failed += st.failed;
+        res.violations += st.violations;
+    }
+    // exactly once: counts and sums of sequence numbers per producer,
+    // checked for each consumer separately in broadcast mode
+    size_t groups = Adapter::broadcast ? consumers_count : 1;
+    for (size_t g = 0; g < groups; g++) {
+        for (size_t p = 0; p < producers_count; p++) {
+            uint64_t count = 0;
+            uint64_t sum = 0;
+            for (size_t c = 0; c < consumers_count; c++) {
+                if (!Adapter::broadcast || g == c) {
+                    count += consumers[c].counts[p];
+                    sum += consumers[c].sums[p];
+                }
+            }
+            uint64_t n = producers[p].sent;
+            if (n != count || n * (n + 1) / 2 != sum) {
+                res.violations += 1;
+                report_violation(Adapter::name(), "lost or duplicated payloads, producer: " + std::to_string(p) +
+                        ", sent: " + std::to_string(n) + ", received: " + std::to_string(count));
+            }
+        }
+    }
+    // every payload is taken by all consumers in broadcast mode
+    if (Adapter::broadcast) {
+        res.take_cycles /= consumers_count;
+    }
+    return res;
+}
+
+void report(std::ostream& out, const char* queue_name, const result& res, double base_ops_per_sec) {
+    double ops_per_sec = static_cast<double>(res.ops) / res.seconds;
+    double ops = static_cast<double>(std::max(res.ops, static_cast<uint64_t>(1)));
+    out << queue_name << "," << res.producers << "," << res.consumers << "," << res.seconds << ","
+            << res.ops << "," << static_cast<uint64_t>(ops_per_sec) << ","
+            << (base_ops_per_sec > 0 ? ops_per_sec / base_ops_per_sec : 1.0) << ","
+            << static_cast<uint64_t>(static_cast<double>(res.put_cycles) / ops) << ","
+            << static_cast<uint64_t>(static_cast<double>(res.take_cycles) / ops) << ","
+            << res.put_failed << "," << res.take_failed << "," << res.violations << std::endl;
+}
+
+template<typename Adapter>
+uint64_t stress(std::ostream& out, const config& cfg) {
+    if (!cfg.filter.empty() && cfg.filter != Adapter::name()) {
+        return 0;
+    }
+    uint64_t violations = 0;
+    double base_ops_per_sec = 0;
+    size_t prev_producers = 0;
+    size_t prev_consumers = 0;
+    // copied to avoid odr-use of static members
+    const size_t max_producers = Adapter::max_producers;
+    const size_t max_consumers = Adapter::max_consumers;
+    for (size_t threads = 1; ; threads = std::min(threads * 2, cfg.threads)) {
+        size_t producers = std::min(threads, max_producers);
+        size_t consumers = std::min(threads, max_consumers);
+        if (producers == prev_producers && consumers == prev_consumers) {
+            break;
+        }
+        std::cerr << Adapter::name() << " producers: " << producers << " consumers: " << consumers << std::endl;
+        result res = run<Adapter>(cfg, producers, consumers);
+        report(out, Adapter::name(), res, base_ops_per_sec);
+        if (0 == base_ops_per_sec) {
+            base_ops_per_sec = static_cast<double>(res.ops) / res.seconds;
+        }
+        violations += res.violations;
+        prev_producers = producers;
+        prev_consumers = consumers;
+    }
+    return violations;
+}
+
+size_t env_or(const char* name, size_t def) {
+    const char* val = std::getenv(name);
+    return nullptr != val && '\0' != val[0] ? std::strtoul(val, nullptr, 10) : def;
+}
+
+config parse_args(int argc, char** argv) {
+    config cfg;
+    unsigned int cores = std::thread::hardware_concurrency();
+    cfg.threads = env_or("STRESS_THREADS", cores > 0 ? cores : cfg.threads);
+    cfg.millis = env_or("STRESS_MILLIS", cfg.millis);
+    cfg.capacity = env_or("STRESS_CAPACITY", cfg.capacity);
+    const char* filter = std::getenv("STRESS_FILTER");
+    if (nullptr != filter) {
+        cfg.filter = filter;
+    }
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if ("--threads" == arg && has_value) {
+            cfg.threads = std::strtoul(argv[++i], nullptr, 10);
+        } else if ("--millis" == arg && has_value) {
+            cfg.millis = std::strtoul(argv[++i], nullptr, 10);
+        } else if ("--capacity" == arg && has_value) {
+            cfg.capacity = std::strtoul(argv[++i], nullptr, 10);
+        } else if ("--filter" == arg && has_value) {
+            cfg.filter = argv[++i];
+        } else if ("--output" == arg && has_value) {
+            cfg.output = argv[++i];
+        } else {
+            std::cerr << "usage: queue_stress [--threads N] [--millis N] [--capacity N]"
+                    " [--filter QUEUE_NAME] [--output FILE]" << std::endl;
+            std::exit(1);
+        }
+    }
+    cfg.threads = std::max(cfg.threads, static_cast<size_t>(1));
+    cfg.capacity = std::max(cfg.capacity, static_cast<size_t>(2));
+    return cfg;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    config cfg = parse_args(argc, argv);
+    std::ofstream file;
+    if (!cfg.output.empty()) {
+        file.open(cfg.output.c_str());
+    }
+    std::ostream& out = cfg.output.empty() ? std::cout : file;
+    out << "queue,producers,consumers,seconds,ops,ops_per_sec,speedup,put_cycles_per_op,"
+            "take_cycles_per_op,put_failed,take_failed,violations" << std::endl;
+    uint64_t violations = 0;
+    violations += stress<pcq_adapter>(out, cfg);
+    violations += stress<blocking_pcq_adapter>(out, cfg);
+    violations += stress<shared_pcq_adapter>(out, cfg);
+    violations += stress<segmented_pcq_adapter>(out, cfg);
+    violations += stress<mpmc_adapter>(out, cfg);
+    violations += stress<blocking_mpmc_adapter>(out, cfg);
+    violations += stress<mpsc_adapter>(out, cfg);
+    violations += stress<blocking_queue_adapter>(out, cfg);
+    violations += stress<sharded_adapter>(out, cfg);
+    violations += stress<blocking_priority_adapter>(out, cfg);
+    violations += stress<delay_adapter>(out, cfg);
+    violations += stress<conflating_adapter>(out, cfg);
+    violations += stress<work_stealing_adapter>(out, cfg);
+    violations += stress<broadcast_adapter>(out, cfg);
+    if (violations > 0) {
+        std::cerr << "FAILED, violations: " << violations << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   work_stealing_deque_test.cpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#include "staticlib/containers/work_stealing_deque.hpp"
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+namespace sc = staticlib::containers;
+
+void test_owner() {
+    sc::work_stealing_deque<int> deque{4};
+    int el = -1;
+    slassert(!deque.pop(el));
+    slassert(!deque.steal(el));
+    for (int i = 0; i < 10; i++) {
+        deque.push(i);
+    }
+    slassert(10 == deque.size_guess());
+    slassert(deque.capacity() >= 10);
+    // owner pops LIFO
+    slassert(deque.pop(el));
+    slassert(9 == el);
+    // thieves steal FIFO
+    slassert(deque.steal(el));
+    slassert(0 == el);
+    slassert(deque.steal(el));
+    slassert(1 == el);
+    for (int i = 8; i >= 2; i--) {
+        slassert(deque.pop(el));
+        slassert(i == el);
+    }
+    slassert(deque.is_empty());
+    slassert(!deque.pop(el));
+    slassert(!deque.steal(el));
+}
+
+void test_thieves() {
+    const int count = 200000;
+    const int thieves_count = 3;
+    sc::work_stealing_deque<int> deque{16};
+    std::vector<std::atomic<int>> seen(count);
+    for (auto& fl : seen) {
+        fl.store(0);
+    }
+    std::atomic<bool> done{false};
+    std::vector<std::thread> thieves;
+    for (int i = 0; i < thieves_count; i++) {
+        thieves.emplace_back([&deque, &seen, &done] {
+            int el = -1;
+            for (;;) {
+                if (deque.steal(el)) {
+                    seen[el].fetch_add(1);
+                } else if (done.load()) {
+                    break;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    int el = -1;
+    for (int i = 0; i < count; i++) {
+        deque.push(i);
+        // owner pops some of the elements itself
+        if (0 == i % 3 && deque.pop(el)) {
+            seen[el].fetch_add(1);
+        }
+    }
+    while (deque.pop(el)) {
+        seen[el].fetch_add(1);
+    }
+    done.store(true);
+    for (auto& th : thieves) {
+        th.join();
+    }
+    for (auto& fl : seen) {
+        slassert(1 == fl.load());
+    }
+}
+
+int main() {
+    try {
+        test_owner();
+        test_thieves();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
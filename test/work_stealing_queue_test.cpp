@@ -0,0 +1,117 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   work_stealing_queue_test.cpp
+ * Author: alex
+ *
+ * Created on October 14, 2026
+ */
+
+#include "staticlib/containers/work_stealing_queue.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+namespace sc = staticlib::containers;
+
+void test_single() {
+    sc::work_stealing_queue<int> queue{2};
+    slassert(2 == queue.workers_count());
+    int task = -1;
+    slassert(!queue.poll(0, task));
+    queue.submit(1);
+    queue.push(1, 2);
+    slassert(2 == queue.size_guess());
+    // injector first
+    slassert(queue.poll(0, task));
+    slassert(1 == task);
+    // stolen from worker 1
+    slassert(queue.poll(0, task));
+    slassert(2 == task);
+    queue.push(0, 3);
+    slassert(queue.poll(0, task));
+    slassert(3 == task);
+    auto start = std::chrono::steady_clock::now();
+    slassert(!queue.take(0, task, 100));
+    slassert(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds{100});
+}
+
+void test_fork_join() {
+    // each task with depth > 0 spawns two subtasks
+    const int depth = 14;
+    const size_t workers_count = 4;
+    sc::work_stealing_queue<int> queue{workers_count, 8};
+    std::atomic<int> executed{0};
+    std::atomic<int> pending{1};
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < workers_count; i++) {
+        workers.emplace_back([&queue, &executed, &pending, i] {
+            int task = -1;
+            while (queue.take(i, task)) {
+                executed.fetch_add(1);
+                if (task > 0) {
+                    pending.fetch_add(2);
+                    queue.push(i, task - 1);
+                    queue.push(i, task - 1);
+                }
+                if (1 == pending.fetch_sub(1)) {
+                    queue.unblock();
+                }
+            }
+        });
+    }
+    queue.submit(depth);
+    for (auto& th : workers) {
+        th.join();
+    }
+    slassert((1 << (depth + 1)) - 1 == executed.load());
+    slassert(0 == queue.size_guess());
+}
+
+void test_unblock() {
+    sc::work_stealing_queue<int> queue{2};
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < 2; i++) {
+        workers.emplace_back([&queue, i] {
+            int task = -1;
+            slassert(!queue.take(i, task));
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    queue.unblock();
+    for (auto& th : workers) {
+        th.join();
+    }
+    slassert(!queue.is_blocking());
+}
+
+int main() {
+    try {
+        test_single();
+        test_fork_join();
+        test_unblock();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}